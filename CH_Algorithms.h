@@ -0,0 +1,1272 @@
+/*
+ * CH_Algorithms.h
+ *
+ * Descp: This module provides the implementation of some algorithms which solves the ConvexHull problem.
+ * Either in an iterative way, either in a recursive way (divide and conquer)
+ * 
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre:
+ * 	>A set of points, in an array form (Point<T>: float, double, int32_t or int64_t coordinates).
+ * 	>The number of points in the set above.
+ *
+ * Post: 
+ *  <std::vector of the points which represents the convex hull set.
+ * 		conditions of output:
+ * 			* The points in the vector are sorted in clockwise order from the first point until the last point
+ * 			* The first point in the vector is the leftmost point
+ *
+ ******************************************************************************
+ *  Created on: 02-04-2014
+ *      Author: Abel Serrano
+ * 
+ * Possible improves:
+ * 
+ */
+ 
+#ifndef CH_ALGORITHMS_H
+#define CH_ALGORITHMS_H
+
+#include "point/Point.h"
+#include "point/PointSet.h"
+#include "heap/heap-sort.h"
+#include "sort/radix-sort.h"
+#include "sort/parallel-sort.h"
+#include "orientation/orientation.h" //turn(), orientation tests
+#include "pool/WorkStealingPool.h"
+#include <deque>
+#include <vector>
+#include <cmath> //for abs
+#include <iostream>
+#include <algorithm> //for lower_bound
+#include <stdint.h> //for uint32_t
+#include <cassert>
+
+#undef DEBUG //To activate or not the verbose mode
+
+/************** DEBUG UTILITIES ***************/
+
+#ifdef DEBUG
+#include <string>
+#include <sstream> 
+#define writedbg( x ) std::cout << x
+#define writelndbg( x ) std::cout << x << std::endl
+#else
+#define writedbg( x ) 
+#define writelndbg( x ) 
+#define printVectorDbg( x ) 
+#define printArrayDbg( x, n ) 
+#endif
+
+#ifdef DEBUG
+template<class T>
+void printVectorDbg(vector<Point<T> > s)
+{
+	ostringstream string_point;
+	
+	for (auto it = begin(s); it != end(s); ++it)
+	{
+		string_point.str("");	//Initialize stream
+		string_point << '(' << it->x() << ',' << it->y() << ')'; //Construct the string in the form: (x,y) for each point
+		std::cout << string_point.str() << ", ";						//Print the stream into the default output
+	}
+		
+	std::cout << std::endl;
+}
+
+template<class T>
+void printArrayDbg(const Point<T> s[], int n)
+{
+	printVectorDbg(vector<Point<T> >(s, s + n));
+}
+#endif
+
+/*****************************/
+
+
+/************** OPTIONS ***************/
+
+/**
+ * Statistics of one execution of a convex hull algorithm
+ */
+struct HullStats
+{
+	int culledPoints;		//points discarded by the prefilter
+	long long exactTurns;	//orientation tests solved by the slow path of turnAdaptive (with exactOrientation)
+	int dcFallbackMerges;	//D&C merges whose tangent lines weren't found, done by monotone chain (see merge)
+	
+	HullStats() : culledPoints(0), exactTurns(0), dcFallbackMerges(0) {}
+};
+
+//Default number of points below which the parallel divide and conquer doesn't split the set in more tasks
+const int DC_PARALLEL_GRAIN = 8192;
+
+//Default number of points below which the divide and conquer solves the set by monotone chain.
+//The best one for a machine is given by bench_CH_Algorithms.cpp, and it can be built in by defining
+//CONVEXHULL_DC_CUTOFF (the CMake option of the same name).
+#ifndef CONVEXHULL_DC_CUTOFF
+#define CONVEXHULL_DC_CUTOFF 256
+#endif
+const int DC_MONOTONE_CUTOFF = CONVEXHULL_DC_CUTOFF;
+
+/**
+ * Settings for the convex hull algorithms.
+ * The functions without options argument use the default ones.
+ */
+struct HullOptions
+{
+	int sortThreads;		//number of threads to sort the input set of points (1 = no extra threads)
+	bool prefilter;			//discard the points inside the polygon of the extreme points before sorting
+	int prefilterExtremes;	//number of extreme points for the prefilter polygon: 4 or 8
+	int dcThreads;			//number of threads for the divide and conquer recursion (1 = sequential)
+	int dcGrain;			//sets of less points than this are solved by one task, sequentially
+	int dcCutoff;			//sets of this number of points or less are solved by monotone chain, not split (3 = never)
+	WorkStealingPool *dcPool;	//if it is not null, the parallel recursion runs on it (instead of dcThreads)
+	bool exactOrientation;	//exact orientation tests (turnAdaptive) instead of turn, which has got a tolerance
+	HullStats *stats;		//if it is not null, the statistics of the execution are written there
+	
+	HullOptions() : sortThreads(1), prefilter(false), prefilterExtremes(8), dcThreads(1), dcGrain(DC_PARALLEL_GRAIN),
+		dcCutoff(DC_MONOTONE_CUTOFF), dcPool(NULL), exactOrientation(false), stats(NULL) {}
+};
+
+/*****************************/
+
+
+/************** SORTING ***************/
+
+//Below this number of points heap sort is faster than radix sort (no counters to clear and fill)
+const int RADIX_SORT_MIN_POINTS = 1024;
+
+/**
+ * Sorts keys of points (see radix-sort.h) in ascending order.
+ * Complexity: O(n log n) for small sets by heap sort, O(n) for big ones by radix sort
+ */
+template<class Key>
+void sortKeys(Key keys[], int numberKeys)
+{
+	if (numberKeys < RADIX_SORT_MIN_POINTS)
+		heapSort<Key>(keys,numberKeys);
+	else
+	{
+		std::vector<Key> buffer(numberKeys);
+		Key *sorted = radixSortKeys(keys, buffer.data(), numberKeys);
+		if (sorted != keys)
+			std::copy(buffer.begin(), buffer.end(), keys);
+	}
+}
+
+/**
+ * Sorts the points in ascending order of x-values (and y-values for the same x-value).
+ * Small sets are heap sorted by the keys of the points (see radix-sort.h) instead of by Point::operator>,
+ * which has got a tolerance, so both ways give the same exact order (needed by the exact orientation tests).
+ * Complexity: O(n log n) for small sets by heap sort, O(n) for big ones by radix sort
+ */
+template<class T>
+void sortPoints(Point<T> P[], int numberPoints)
+{
+	typedef typename PointKey<T>::Type Key;
+	if (numberPoints < RADIX_SORT_MIN_POINTS)
+	{
+		Key keys[RADIX_SORT_MIN_POINTS];
+		for (int i = 0; i < numberPoints; i++)
+			keys[i] = pointToKey(P[i]);
+		heapSort<Key>(keys,numberPoints);
+		for (int i = 0; i < numberPoints; i++)
+			P[i] = keyToPoint<T>(keys[i]);
+	}
+	else
+		radixSort(P,numberPoints);
+}
+
+/**
+ * Exact comparison of the coordinates of two points (Point::operator== has got a tolerance).
+ * Since the sorted points are in lexicographic order, the repeated points are together.
+ */
+template<class T>
+inline bool samePoint(const Point<T> &p, const Point<T> &q)
+{
+	return p.x() == q.x() && p.y() == q.y();
+}
+
+/**
+ * Same as above, but with nThreads threads, each one sorting a chunk of the set.
+ * The keys are sorted instead of the points, so the merges of the chunks are exact too.
+ */
+template<class T>
+void sortPoints(Point<T> P[], int numberPoints, int nThreads)
+{
+	typedef typename PointKey<T>::Type Key;
+	if (nThreads > 1)
+	{
+		std::vector<Key> keys(numberPoints);
+		for (int i = 0; i < numberPoints; i++)
+			keys[i] = pointToKey(P[i]);
+		parallelSort<Key>(keys.data(),numberPoints,nThreads,sortKeys<Key>);
+		for (int i = 0; i < numberPoints; i++)
+			P[i] = keyToPoint<T>(keys[i]);
+	}
+	else
+		sortPoints(P,numberPoints);
+}
+
+/**
+ * Key of a point (see radix-sort.h) with the index of the point, for sorting indices by heap sort.
+ * Same keys are sorted by index, so the order is the same than the (stable) radix sort one.
+ */
+template<class Key>
+struct IndexedKey
+{
+	Key key;
+	uint32_t index;
+	
+	bool operator>(const IndexedKey& other) const
+	{
+		return key > other.key || (key == other.key && index > other.index);
+	}
+};
+
+/**
+ * Returns the permutation of indices which sorts the points in ascending order of x-values (and y-values
+ * for the same x-value), without moving them: P[perm[0]] <= P[perm[1]] <= ... <= P[perm[n-1]]
+ * P can be an array of points or a PointSet.
+ * Complexity: O(n log n) for small sets by heap sort, O(n) for big ones by radix sort
+ */
+template<class Points>
+std::vector<uint32_t> sortIndices(const Points &P, int numberPoints)
+{
+	if (numberPoints >= RADIX_SORT_MIN_POINTS)
+		return radixSortIndices(P,numberPoints);
+	
+	typedef IndexedKey<decltype(pointToKey(P[0]))> Key;
+	std::vector<Key> keys(numberPoints);
+	for (int i = 0; i < numberPoints; i++)
+	{
+		keys[i].key = pointToKey(P[i]);
+		keys[i].index = i;
+	}
+	heapSort<Key>(keys.data(),numberPoints);
+	
+	std::vector<uint32_t> perm(numberPoints);
+	for (int i = 0; i < numberPoints; i++)
+		perm[i] = keys[i].index;
+	return perm;
+}
+
+/*****************************/
+
+
+/************** PREFILTER (AKL-TOUSSAINT) ***************/
+
+/**
+ * Calculates the polygon formed by the extreme points of P in 4 directions (left, up, right, down)
+ * or 8 directions (the 4 above and the diagonals). Every extreme point is a vertex of the convex hull.
+ * The vertices are written in clockwise order starting from the leftmost one, without repeated
+ * consecutive vertices, and the function returns how many they are.
+ */
+template<class T>
+int extremePointsPolygon(const Point<T> P[], int numberPoints, int nExtremes, Point<T> polygon[])
+{
+	//Index of the point with the max. value of dx*x + dy*y, for every direction (dx,dy) in clockwise order:
+	//(-1,0), (-1,1), (0,1), (1,1), (1,0), (1,-1), (0,-1), (-1,-1)
+	//Ties are broken by the max. value of -dy*x + dx*y (the direction 90 degrees counter-clockwise), so the
+	//extreme point is the first one found going clockwise (e.g. the lowest of the leftmost points).
+	const int DIRECTIONS = 8;
+	int extreme[DIRECTIONS] = {-1, -1, -1, -1, -1, -1, -1, -1};
+	T bestTie[DIRECTIONS] = {};	//only read once extreme[d] is set
+	
+	//First pass, only the max. values (without branches, so the compiler can vectorize it)
+	T x = P[0].x(), y = P[0].y();
+	T maxX = x, maxY = y, maxSum = x + y, maxDiff = x - y;
+	T minX = x, minY = y, minSum = x + y, minDiff = x - y;
+	for (int i = 1; i < numberPoints; i++)
+	{
+		x = P[i].x();
+		y = P[i].y();
+		maxX = std::max(maxX, x);
+		maxY = std::max(maxY, y);
+		maxSum = std::max(maxSum, x + y);
+		maxDiff = std::max(maxDiff, x - y);
+		minX = std::min(minX, x);
+		minY = std::min(minY, y);
+		minSum = std::min(minSum, x + y);
+		minDiff = std::min(minDiff, x - y);
+	}
+	const T bestProjection[DIRECTIONS] = {-minX, -minDiff, maxY, maxSum, maxX, maxDiff, -minY, -minSum};
+	
+	//Second pass, the points with those values
+	for (int i = 0; i < numberPoints; i++)
+	{
+		x = P[i].x();
+		y = P[i].y();
+		//(bitwise or, so there is one branch instead of eight, and it is rarely taken)
+		if ((x == minX) | (x == maxX) | (y == minY) | (y == maxY)
+			| (x + y == minSum) | (x + y == maxSum) | (x - y == minDiff) | (x - y == maxDiff))
+		{
+			T sum = x + y, diff = x - y;
+			const T projection[DIRECTIONS] = {-x, -diff, y, sum, x, diff, -y, -sum};
+			const T tie[DIRECTIONS] = {-y, -sum, -x, -diff, y, sum, x, diff};
+			
+			for (int d = 0; d < DIRECTIONS; d++)
+				if (projection[d] == bestProjection[d] && (extreme[d] < 0 || tie[d] > bestTie[d]))
+				{
+					bestTie[d] = tie[d];
+					extreme[d] = i;
+				}
+		}
+	}
+	
+	int step = (nExtremes == 4) ? 2 : 1;	//with 4 extremes, the diagonals are skipped
+	int nVertices = 0;
+	for (int d = 0; d < DIRECTIONS; d += step)
+		if (nVertices == 0 || !(P[extreme[d]].x() == polygon[nVertices-1].x() && P[extreme[d]].y() == polygon[nVertices-1].y()))
+			polygon[nVertices++] = P[extreme[d]];
+	
+	if (nVertices > 1 && polygon[0].x() == polygon[nVertices-1].x() && polygon[0].y() == polygon[nVertices-1].y())
+		--nVertices;
+	return nVertices;
+}
+
+/**
+ * Akl-Toussaint heuristic: discards the points strictly inside the polygon of the extreme points
+ * (see extremePointsPolygon), since they can't be vertices of the convex hull.
+ * The points which are kept are moved to the beginning of P, keeping their order, and the function
+ * returns how many they are.
+ * A point is strictly inside if it makes a right turn with every edge of the polygon (which is clockwise).
+ * The points are processed by blocks, classifying the whole block against every edge by orientationBatch.
+ * orientationBatch has got the tolerance of turn, so if exact is not null the points found inside are
+ * checked again by that exact predicate (this can only keep more points).
+ * Complexity: big theta(n)
+ */
+inline int aklToussaintFilter(Point2f P[], int numberPoints, int nExtremes, const AdaptiveOrientation *exact = NULL)
+{
+	if (numberPoints < 3)
+		return numberPoints;
+	
+	Point2f polygon[8];
+	int nVertices = extremePointsPolygon(P, numberPoints, nExtremes, polygon);
+	if (nVertices < 3)	//all the points are in a line
+		return numberPoints;
+	
+	const int BLOCK = 256;
+	alignas(64) float x[BLOCK];
+	alignas(64) float y[BLOCK];
+	signed char turns[BLOCK];
+	bool inside[BLOCK];
+	int kept = 0;
+	
+	for (int first = 0; first < numberPoints; first += BLOCK)
+	{
+		int size = std::min(BLOCK, numberPoints - first);
+		for (int i = 0; i < size; i++)
+		{
+			x[i] = P[first+i].x();
+			y[i] = P[first+i].y();
+			inside[i] = true;
+		}
+		
+		for (int v = 0; v < nVertices; v++)
+		{
+			orientationBatch(polygon[v], polygon[(v+1) % nVertices], x, y, size, turns);
+			for (int i = 0; i < size; i++)
+				inside[i] &= (turns[i] < 0);
+		}
+		
+		if (exact != NULL)
+			for (int i = 0; i < size; i++)
+				for (int v = 0; v < nVertices && inside[i]; v++)
+					inside[i] = (*exact)(polygon[v], polygon[(v+1) % nVertices], P[first+i]) < 0;
+		
+		//Every point in the block is read before its position is overwritten, since kept <= first+i
+		for (int i = 0; i < size; i++)
+		{
+			P[kept] = P[first+i];
+			kept += !inside[i];
+		}
+	}
+	
+	return kept;
+}
+
+/**
+ * Same as above for points with other coordinate types (there is no batch orientation test for them):
+ * every point is classified by turn against every edge of the polygon, or by exact if it is not null.
+ * Complexity: big theta(n)
+ */
+template<class T>
+int aklToussaintFilter(Point<T> P[], int numberPoints, int nExtremes, const AdaptiveOrientation *exact = NULL)
+{
+	if (numberPoints < 3)
+		return numberPoints;
+	
+	Point<T> polygon[8];
+	int nVertices = extremePointsPolygon(P, numberPoints, nExtremes, polygon);
+	if (nVertices < 3)	//all the points are in a line
+		return numberPoints;
+	
+	int kept = 0;
+	for (int i = 0; i < numberPoints; i++)
+	{
+		bool inside = true;
+		for (int v = 0; v < nVertices && inside; v++)
+			inside = ((exact != NULL) ? (*exact)(polygon[v], polygon[(v+1) % nVertices], P[i])
+				: turn(polygon[v], polygon[(v+1) % nVertices], P[i])) < 0;
+		
+		P[kept] = P[i];	//kept <= i
+		kept += !inside;
+	}
+	
+	return kept;
+}
+
+/**
+ * Applies the prefilter if it is enabled in options, and writes how many points were discarded in the stats.
+ * Returns the number of points left at the beginning of P.
+ */
+template<class T>
+inline int prefilterPoints(Point<T> P[], int numberPoints, const HullOptions &options, const AdaptiveOrientation &exact)
+{
+	int kept = numberPoints;
+	if (options.prefilter)
+		kept = aklToussaintFilter(P, numberPoints, options.prefilterExtremes, options.exactOrientation ? &exact : NULL);
+	
+	if (options.stats != NULL)
+		options.stats->culledPoints = numberPoints - kept;
+	return kept;
+}
+
+/**
+ * Writes in the stats how many orientation tests went to the slow path of turnAdaptive
+ */
+inline void writeExactTurns(const HullOptions &options, const std::atomic<long long> &exactTurns)
+{
+	if (options.stats != NULL)
+		options.stats->exactTurns = exactTurns.load();
+}
+
+/*****************************/
+
+
+/************** ITERATIVE ALGORITHM ***************/
+
+inline std::deque<Point2f> UpperHull(Point2f L[], int n)
+{
+	Point2f last1 (L[0]), last2(L[1]), last3 ;// Last 3 points in the list 
+	
+	std::deque< Point2f > Lupper; //At least, it's going to store 3 points
+	Lupper.push_back(last1);
+	Lupper.push_back(last2);
+	
+	for (int i=2; i<n;i++)
+	{
+		Lupper.push_back(L[i]);
+		last3 = L[i];
+		while (Lupper.size() > 2 && turn(last1, last2, last3)>=0) //right turn is when the cross-product is <0
+			{
+				Lupper.pop_back(); //Remove last3 from deque
+				Lupper.pop_back(); //Remove last2 from deque
+				
+				last2 = last1;		// last2 now is --last2 (i.e., last1)
+				
+				if (Lupper.size() > 1)
+				{
+					Lupper.pop_back();
+					last1 = Lupper.back(); //this two lines is equivalent to say --last1 (last 1 is previous last1)
+					Lupper.push_back(last2); //Restore previous last1
+				}
+				
+				Lupper.push_back(last3); //Restore last3
+			}
+			
+		//Advancing last points of the deque
+		last1 = last2;
+		last2 = last3;
+	}
+	return Lupper;
+}
+
+inline std::deque<Point2f> LowerHull(Point2f L[], int n)
+{
+	Point2f last1(L[n-1]), last2(L[n-2]), last3;
+	
+	std::deque< Point2f > LLower; //At least, it's going to store 3 points
+	LLower.push_back(last1);
+	LLower.push_back(last2);
+	
+	for (int i = n-3; i>=0; --i)
+	{
+		LLower.push_back(last3 = L[i]);
+		while ( LLower.size() > 2 && turn(last1,last2,last3) >= 0)
+		{
+			LLower.pop_back(); //Remove last3 from deque
+				LLower.pop_back(); //Remove last2 from deque
+				
+				last2 = last1;		// last2 now is --last2 (i.e., last1)
+				
+				if (LLower.size() > 1)
+				{
+					LLower.pop_back();
+					last1 = LLower.back(); //this two lines is equivalent to say --last1 (last 1 is previous last1)
+					LLower.push_back(last2); //Restore previous last1
+				}
+				
+				LLower.push_back(last3); //Restore last3
+		}
+			
+		//Advancing last points of the deque
+		last1 = last2;
+		last2 = last3;
+		
+	}
+	
+	return LLower;	
+}
+
+/**
+ * Upper and lower hulls of the sorted points of P, with the orientation predicate turn
+ * (EpsilonOrientation or AdaptiveOrientation), as two stacks on hull (see IterativeConvexHull below).
+ * Complexity: big theta(n)
+ */
+template<class T, class Orientation>
+int monotoneChain (const Point<T> P[], int numberPoints, Point<T> hull[], const Orientation &turn)
+{
+	if (numberPoints < 3 || samePoint(P[0], P[numberPoints-1]))	//a repeated point has got one vertex
+	{
+		int size = 0;
+		for (int i = 0; i < numberPoints; i++)
+			if (size == 0 || !samePoint(P[i], hull[size-1]))
+				hull[size++] = P[i];
+		return size;
+	}
+	
+	int top = -1;	//index of the last point of the stack
+	
+	//Upper hull, from the leftmost to the rightmost point
+	for (int i = 0; i < numberPoints; i++)
+	{
+		while (top > 0 && turn(hull[top-1], hull[top], P[i]) >= 0) //right turn is when the cross-product is <0
+			--top;
+		hull[++top] = P[i];
+	}
+	
+	//Lower hull, from the rightmost (the top of the upper hull) to the leftmost point
+	int upperTop = top;
+	for (int i = numberPoints-2; i >= 0; i--)
+	{
+		while (top > upperTop && turn(hull[top-1], hull[top], P[i]) >= 0)
+			--top;
+		hull[++top] = P[i];
+	}
+	
+	return top;	//the leftmost point is at hull[top] too, so it is not counted twice
+}
+
+/**
+ * Allocation-free version: the upper and the lower hulls are built as two stacks on the same
+ * output buffer (hull), which must have room for numberPoints+1 points. The top of the stacks is just an index.
+ * Returns the number of vertices of the convex hull, which are in hull[0..return-1] with the same order
+ * than in the vector version.
+ * Nothing is allocated while building the hull; neither while sorting for sets smaller than
+ * RADIX_SORT_MIN_POINTS with only one sort thread (heap sort is in place).
+ * Complexity: big theta(n)
+ */
+template<class T>
+int IterativeConvexHull (Point<T> P[], int numberPoints, Point<T> hull[], const HullOptions &options)
+{
+	std::atomic<long long> exactTurns(0);
+	AdaptiveOrientation adaptive(&exactTurns);
+	
+	numberPoints = prefilterPoints(P,numberPoints,options,adaptive);
+	sortPoints(P,numberPoints,options.sortThreads);
+	
+	int size;
+	if (options.exactOrientation)
+		size = monotoneChain(P,numberPoints,hull,adaptive);
+	else
+		size = monotoneChain(P,numberPoints,hull,EpsilonOrientation());
+	
+	writeExactTurns(options,exactTurns);
+	return size;
+}
+
+template<class T>
+int IterativeConvexHull (Point<T> P[], int numberPoints, Point<T> hull[])
+{
+	return IterativeConvexHull(P,numberPoints,hull,HullOptions());
+}
+
+/**
+ * Monotone chain on the sorted points of P, writing the convex hull in P itself (same order than
+ * IterativeConvexHull) and returning its number of points and the index of the rightmost one.
+ * The lower hull is built first, in lowerHull (room for numberPoints points), and then the upper hull
+ * is built in place: its stack never goes beyond the point being read. Finally the lower hull is appended.
+ * It is the base case of the divide and conquer algorithm for small sets.
+ * Complexity: big theta(n)
+ */
+template<class T, class Orientation>
+int monotoneChainInPlace (Point<T> P[], int numberPoints, Point<T> lowerHull[], int &indexRightMost,
+	const Orientation &turn)
+{
+	int top = -1;
+	
+	//Lower hull, from the rightmost to the leftmost point
+	for (int i = numberPoints-1; i >= 0; i--)
+	{
+		while (top > 0 && turn(lowerHull[top-1], lowerHull[top], P[i]) >= 0)
+			--top;
+		lowerHull[++top] = P[i];
+	}
+	int lowerSize = top + 1;
+	
+	//Upper hull, from the leftmost to the rightmost point
+	top = -1;
+	for (int i = 0; i < numberPoints; i++)
+	{
+		while (top > 0 && turn(P[top-1], P[top], P[i]) >= 0)
+			--top;
+		P[++top] = P[i];
+	}
+	indexRightMost = top;
+	
+	//The lower hull without its first and last points (the rightmost and the leftmost ones)
+	for (int i = 1; i < lowerSize-1; i++)
+		P[++top] = lowerHull[i];
+	
+	return top + 1;
+}
+
+/**
+ * Complexity: big theta(n)
+ */
+template<class T>
+std::vector<Point<T> > IterativeConvexHull (Point<T> P[], int numberPoints, const HullOptions &options)
+{
+	std::vector<Point<T> > iterativeConvexHull(numberPoints+1);
+	iterativeConvexHull.resize(IterativeConvexHull(P,numberPoints,&iterativeConvexHull[0],options));
+	return iterativeConvexHull;
+}
+
+template<class T>
+std::vector<Point<T> > IterativeConvexHull (Point<T> P[], int numberPoints)
+{
+	return IterativeConvexHull(P,numberPoints,HullOptions());
+}
+
+/**
+ * Upper and lower hulls of P as stacks of indices on the sorted permutation of P (sorted).
+ * Returns the indices of the convex hull vertices, in the same order than IterativeConvexHull.
+ * P can be an array of points or a PointSet.
+ * Complexity: big theta(n)
+ */
+template<class Points>
+std::vector<uint32_t> monotoneChainIndices (const Points &P, const std::vector<uint32_t> &sorted)
+{
+	int numberPoints = sorted.size();
+	if (numberPoints > 1 && samePoint(P[sorted[0]], P[sorted[numberPoints-1]]))	//a repeated point has got one vertex
+		return std::vector<uint32_t>(1, sorted[0]);
+	if (numberPoints < 3)
+		return sorted;
+	
+	std::vector<uint32_t> hull;
+	hull.reserve(numberPoints+1);
+	
+	//Upper hull, from the leftmost to the rightmost point
+	for (int i = 0; i < numberPoints; i++)
+	{
+		while (hull.size() > 1 && turn(P[hull[hull.size()-2]], P[hull.back()], P[sorted[i]]) >= 0)
+			hull.pop_back();
+		hull.push_back(sorted[i]);
+	}
+	
+	//Lower hull, from the rightmost (already in the upper hull) to the leftmost point
+	unsigned int upperSize = hull.size();
+	for (int i = numberPoints-2; i >= 0; i--)
+	{
+		while (hull.size() > upperSize && turn(P[hull[hull.size()-2]], P[hull.back()], P[sorted[i]]) >= 0)
+			hull.pop_back();
+		hull.push_back(sorted[i]);
+	}
+	hull.pop_back();	//the leftmost point is the first one of the upper hull too
+	
+	return hull;
+}
+
+/**
+ * Same as IterativeConvexHull, but it doesn't move the points of P and it returns the indices (in P)
+ * of the convex hull vertices, with the same order.
+ */
+template<class T>
+std::vector<uint32_t> IterativeConvexHullIndices (const Point<T> P[], int numberPoints)
+{
+	return monotoneChainIndices(P,sortIndices(P,numberPoints));
+}
+
+/**
+ * Same as above, for a set of points stored as columns.
+ */
+inline std::vector<uint32_t> IterativeConvexHullIndices (const PointSet &P)
+{
+	return monotoneChainIndices(P,sortIndices(P,P.size()));
+}
+
+/**
+ * Convex hull of a set of points stored as columns, sorted in clockwise order and starting with the
+ * leftmost point. P is not modified.
+ */
+inline std::vector<Point2f> IterativeConvexHull (const PointSet &P)
+{
+	std::vector<uint32_t> hullIndices = IterativeConvexHullIndices(P);
+	
+	std::vector<Point2f> iterativeConvexHull(hullIndices.size());
+	for (unsigned int i = 0; i < hullIndices.size(); i++)
+		iterativeConvexHull[i] = P[hullIndices[i]];
+	return iterativeConvexHull;
+}
+
+
+/*****************************/
+
+
+/************** DIVIDE AND CONQUER ALGORITHM ***************/
+
+//The recursion is a template of the coordinate type (T) and of the orientation predicate (turn):
+//EpsilonOrientation or AdaptiveOrientation
+template<class T, class Orientation>
+int DAndCRecursive (Point<T> set[], int size, Point<T> scratch[], int &indexRightMost, int cutoff,
+	const Orientation &turn);
+template<class T, class Orientation>
+int DAndCParallel (Point<T> set[], int size, Point<T> scratch[], int &indexRightMost, WorkStealingPool &pool,
+	int grain, int cutoff, const Orientation &turn);
+template<class T, class Orientation>
+int merge(Point<T> subSetA[], int sizeA, int indexRightMostA, Point<T> subSetB[], int sizeB, int indexRightMostB,
+	Point<T> mergeSet[], int &indexRightMost, const Orientation &turn);
+template<class T, class Orientation>
+int mergeByMonotoneChain(Point<T> subSetA[], int sizeA, const Point<T> subSetB[], int sizeB, Point<T> mergeSet[],
+	int &indexRightMost, const Orientation &turn);
+//the orientation test of the tangent lines: turnAdaptive, counting its exact tests if turn does
+inline const AdaptiveOrientation& bridgeOrientation(const AdaptiveOrientation &turn) { return turn; }
+inline AdaptiveOrientation bridgeOrientation(const EpsilonOrientation &) { return AdaptiveOrientation(); }
+//the sub-hulls are exactly convex, so their tangent lines are always found
+inline bool isExactOrientation(const AdaptiveOrientation &) { return true; }
+inline bool isExactOrientation(const EpsilonOrientation &) { return false; }
+
+/**
+ * Orientation predicate of the recursion: the one of the options, plus the counter of the merges done by
+ * monotone chain (HullStats::dcFallbackMerges), which can be null.
+ */
+template<class Orientation>
+struct DAndCOrientation : public Orientation
+{
+	std::atomic<int> *fallbackMerges;
+	
+	DAndCOrientation(const Orientation &turn, std::atomic<int> *fallbackMerges)
+		: Orientation(turn), fallbackMerges(fallbackMerges) {}
+};
+
+template<class Orientation>
+inline void countFallbackMerge(const Orientation &) {}
+template<class Orientation>
+inline void countFallbackMerge(const DAndCOrientation<Orientation> &turn)
+{
+	if (turn.fallbackMerges != NULL)
+		++*turn.fallbackMerges;
+}
+//returns the tangent vertices for the upper tangent line in the two ints before turn, or false if they weren't found
+template<class T, class Orientation>
+bool upperTangentPoints(const Point<T> subSetA[], int sizeA, const Point<T> subSetB[], int sizeB,
+	int indexRightMostA, int indexLeftMostB, int &tanPinA, int &tanPinB, const Orientation &turn);
+//returns the tangent vertices for the lower tangent line in the two ints before turn, or false if they weren't found
+template<class T, class Orientation>
+bool lowerTangentPoints(const Point<T> subSetA[], int sizeA, const Point<T> subSetB[], int sizeB,
+	int indexRightMostA, int indexLeftMostB, int &tanPinA, int &tanPinB, const Orientation &turn);
+template<class T, class Orientation>
+bool isUpperTangent(const Point<T> &p1, const Point<T> &p2, const Point<T> &next, bool nextOfP1, const Orientation &turn);
+template<class T, class Orientation>
+bool isLowerTangent(const Point<T> &p1, const Point<T> &p2, const Point<T> &next, bool nextOfP1, const Orientation &turn);
+
+/**
+ * Parallel recursion on pool, with exact orientation tests or not (see DAndCSortedSet)
+ */
+template<class T>
+int DAndCParallelSet (Point<T> set[], int size, Point<T> scratch[], WorkStealingPool &pool, const HullOptions &options,
+	const AdaptiveOrientation &adaptive, std::atomic<int> &fallbackMerges)
+{
+	int indexRightMost;
+	int grain = std::max(options.dcGrain, 3);
+	if (options.exactOrientation)
+		return DAndCParallel(set, size, scratch, indexRightMost, pool, grain, options.dcCutoff,
+			DAndCOrientation<AdaptiveOrientation>(adaptive, &fallbackMerges));
+	else
+		return DAndCParallel(set, size, scratch, indexRightMost, pool, grain, options.dcCutoff,
+			DAndCOrientation<EpsilonOrientation>(EpsilonOrientation(), &fallbackMerges));
+}
+
+/**
+ * Runs the recursion chosen by options (sequential or parallel, with exact orientation tests or not) on the
+ * sorted and distinct points of set, and returns the size of their convex hull, written at the beginning of set.
+ * scratch is the working area of the merges, with room for size points.
+ */
+template<class T>
+int DAndCSortedSet (Point<T> set[], int size, Point<T> scratch[], const HullOptions &options,
+	const AdaptiveOrientation &adaptive)
+{
+	int indexRightMost, hullSize;
+	std::atomic<int> fallbackMerges(0);
+	int nThreads = (options.dcPool != NULL) ? options.dcPool->size() : options.dcThreads;
+	if (nThreads > 1 && size > options.dcGrain)
+	{
+		//A pool given by the caller is reused, so its threads are not created and joined again in every call
+		if (options.dcPool != NULL)
+			hullSize = DAndCParallelSet(set, size, scratch, *options.dcPool, options, adaptive, fallbackMerges);
+		else
+		{
+			WorkStealingPool pool(options.dcThreads);
+			hullSize = DAndCParallelSet(set, size, scratch, pool, options, adaptive, fallbackMerges);
+		}
+	}
+	else if (options.exactOrientation)
+		hullSize = DAndCRecursive(set, size, scratch, indexRightMost, options.dcCutoff,
+			DAndCOrientation<AdaptiveOrientation>(adaptive, &fallbackMerges));
+	else
+		hullSize = DAndCRecursive(set, size, scratch, indexRightMost, options.dcCutoff,
+			DAndCOrientation<EpsilonOrientation>(EpsilonOrientation(), &fallbackMerges));
+	
+	if (options.stats != NULL)
+		options.stats->dcFallbackMerges = fallbackMerges.load();
+	return hullSize;
+}
+
+/**
+ * Calculates the convex hull set for a given set of points, using a divide and conquer algorithm
+ * Allocation-free version: buffer must have room for 2*numberPoints points, the set of points of the
+ * recursion and the scratch area of the merges. The convex hull is written at the start of buffer,
+ * sorted in clockwise order and starting with the leftmost point, and its number of points is returned.
+ * Nothing is allocated, unless the sort does (see IterativeConvexHull) or options.dcThreads > 1 without
+ * options.dcPool (the pool).
+ */
+template<class T>
+int DivideAndConquestConvexHull (Point<T> P[], int numberPoints, Point<T> buffer[], const HullOptions &options)
+{
+	std::atomic<long long> exactTurns(0);
+	AdaptiveOrientation adaptive(&exactTurns);
+	
+	numberPoints = prefilterPoints(P,numberPoints,options,adaptive);
+	
+	//Sorting input in ascending order of x-values (important because we want to split the sets with points from left to right)
+	sortPoints(P,numberPoints,options.sortThreads);
+	
+	//The recursion works over a copy of the sorted points, plus a scratch area of the same size for the merges.
+	//This is all the memory used by the algorithm: O(n)
+	//Repeated points are copied only once: two equal points would be a tangent line without direction.
+	Point<T> *initialSet = buffer;
+	Point<T> *scratch = initialSet + numberPoints;
+	int nDistinct = 0;
+	for (int i = 0; i < numberPoints; i++)
+		if (nDistinct == 0 || !samePoint(P[i], initialSet[nDistinct-1]))
+			initialSet[nDistinct++] = P[i];
+	writedbg("Set to get convex hull by D&C: ");
+	printArrayDbg(initialSet, nDistinct);
+
+	//Calculate actual convex hull set for this input set of points.
+	//It is already sorted in clockwise order from the leftmost point, as we want for the output
+	int hullSize = DAndCSortedSet(initialSet, nDistinct, scratch, options, adaptive);
+	writeExactTurns(options,exactTurns);
+	
+	writedbg("Convex Hull polygon, by divide and conquest algorithm, for this set of points is: ");
+	printArrayDbg(initialSet, hullSize);
+	
+	return hullSize;
+}
+
+/**
+ * Returns a vector which represents the convex hull set, sorted in clockwise order and starting with the 
+ * leftmost point as first point of the vector
+ */
+template<class T>
+std::vector<Point<T> > DivideAndConquestConvexHull (Point<T> P[], int numberPoints, const HullOptions &options)
+{
+	std::vector<Point<T> > outputConvexHullSet(2*numberPoints);
+	outputConvexHullSet.resize(DivideAndConquestConvexHull(P,numberPoints,outputConvexHullSet.data(),options));
+	return outputConvexHullSet;
+}
+
+template<class T>
+std::vector<Point<T> > DivideAndConquestConvexHull (Point<T> P[], int numberPoints)
+{
+	return DivideAndConquestConvexHull(P,numberPoints,HullOptions());
+}
+
+/**
+ * Same as DivideAndConquestConvexHull, but it doesn't move the points of P and it returns the indices (in P)
+ * of the convex hull vertices, with the same order.
+ * The points are sorted by indices, and the recursion runs on the distinct ones in that order (with its scratch
+ * area, as DivideAndConquestConvexHull does with its buffer). Every vertex is found in the sorted indices by
+ * binary search of its key: the index of its first repeated point, as for the ones which were not repeated.
+ * P can be an array of points of coordinates T or a PointSet.
+ * Complexity: O(n log n)
+ */
+template<class T, class Points>
+std::vector<uint32_t> DAndCIndices (const Points &P, int numberPoints)
+{
+	typedef typename PointKey<T>::Type Key;
+	std::vector<uint32_t> sorted = sortIndices(P,numberPoints);
+	
+	std::vector<Point<T> > buffer(2*numberPoints);
+	int nDistinct = 0;
+	for (int i = 0; i < numberPoints; i++)
+		if (nDistinct == 0 || !samePoint(P[sorted[i]], buffer[nDistinct-1]))
+			buffer[nDistinct++] = P[sorted[i]];
+	int hullSize = DAndCSortedSet(buffer.data(), nDistinct, buffer.data() + numberPoints, HullOptions(),
+		AdaptiveOrientation());
+	
+	std::vector<uint32_t> hull(hullSize);
+	for (int i = 0; i < hullSize; i++)
+		hull[i] = *std::lower_bound(sorted.begin(), sorted.end(), pointToKey(buffer[i]),
+			[&P](uint32_t index, const Key &key) { return pointToKey(P[index]) < key; });
+	
+	return hull;
+}
+
+template<class T>
+std::vector<uint32_t> DivideAndConquestConvexHullIndices (const Point<T> P[], int numberPoints)
+{
+	return DAndCIndices<T>(P,numberPoints);
+}
+
+/**
+ * Same as above, for a set of points stored as columns.
+ */
+inline std::vector<uint32_t> DivideAndConquestConvexHullIndices (const PointSet &P)
+{
+	return DAndCIndices<float>(P,P.size());
+}
+
+/**
+ * Base case: 3 points or less, this set of points always accomplish the convex hull property.
+ * Sets of cutoff points or less are solved by monotone chain instead of being split (that is faster for small sets).
+ * Split step: Divide the initial set in two halves (ranges of set) until we get sets in the base case.
+ * Merge step: Produces an union of the subsets obtained above, keeping the convex hull property
+ * The convex hull of set is written at the beginning of set, sorted in clockwise order from the leftmost
+ * point (set[0]), and its number of points is returned. The index of the rightmost point is returned in indexRightMost.
+ * scratch is a working area with room for size points.
+ */
+template<class T, class Orientation>
+int DAndCRecursive (Point<T> set[], int size, Point<T> scratch[], int &indexRightMost, int cutoff,
+	const Orientation &turn)
+{
+	if (size <= 3 )
+	{
+		indexRightMost = size - 1;
+		if (size == 3)
+		{
+			int turnMiddle = turn(set[0], set[1], set[2]);
+			if (turnMiddle == 0)	//the middle point of a straight line is not a vertex
+			{
+				set[1] = set[2];
+				indexRightMost = 1;
+				return 2;
+			}
+			else if (turnMiddle > 0)	//the middle point is under the line, so it goes after the rightmost one
+			{
+				std::swap(set[1], set[2]);
+				indexRightMost = 1;
+			}
+		}
+		return size;
+	}
+	else if (size <= cutoff)
+		return monotoneChainInPlace(set, size, scratch, indexRightMost, turn);
+	else
+	{
+		int half = size / 2;	//set[0..half-1] is the first subset and set[half..size-1] is the second one
+		int indexRightMostA, indexRightMostB;
+		int sizeA = DAndCRecursive(set, half, scratch, indexRightMostA, cutoff, turn);
+		int sizeB = DAndCRecursive(set + half, size - half, scratch + half, indexRightMostB, cutoff, turn);
+		int mergeSize = merge(set, sizeA, indexRightMostA, set + half, sizeB, indexRightMostB, scratch, indexRightMost,
+			turn);
+		std::copy(scratch, scratch + mergeSize, set);
+		return mergeSize;
+	}
+}
+
+/**
+ * Same as DAndCRecursive, but the hulls of both halves are calculated at the same time: the first one
+ * as a new task of pool, and the second one by this thread. Then both are merged as usual.
+ * Sets of grain points or less are solved sequentially, by DAndCRecursive.
+ */
+template<class T, class Orientation>
+int DAndCParallel (Point<T> set[], int size, Point<T> scratch[], int &indexRightMost, WorkStealingPool &pool, int grain,
+	int cutoff, const Orientation &turn)
+{
+	if (size <= grain)
+		return DAndCRecursive(set, size, scratch, indexRightMost, cutoff, turn);
+	
+	int half = size / 2;
+	int sizeA, indexRightMostA, indexRightMostB;
+	WorkStealingPool::TaskGroup left;
+	pool.spawn(left, [&] { sizeA = DAndCParallel(set, half, scratch, indexRightMostA, pool, grain, cutoff, turn); });
+	int sizeB = DAndCParallel(set + half, size - half, scratch + half, indexRightMostB, pool, grain, cutoff, turn);
+	pool.wait(left);
+	
+	int mergeSize = merge(set, sizeA, indexRightMostA, set + half, sizeB, indexRightMostB, scratch, indexRightMost,
+		turn);
+	std::copy(scratch, scratch + mergeSize, set);
+	return mergeSize;
+}
+
+/**
+ * The merge step is the tricky one here
+ * This function call, one by one to every step the algorithm needs to follow to merge two convex polygons,
+ * both sorted in clockwise order from their leftmost point and with every point of subSetA at the left of subSetB.
+ * They are:
+ * 1) Calculate the lower and upper tangents (bridges) to both polygons
+ * 2) Create a new set which is the union of both subsets minus the points which are between the tangent points.
+ * The merged set is written in mergeSet (which can't be the same memory than the subsets), sorted in clockwise
+ * order from the leftmost point too, and its size and the index of its rightmost point are returned.
+ * subSetA must have room for sizeA+sizeB points (see mergeByMonotoneChain).
+ * Complexity: O(sizeA + sizeB)
+ */
+template<class T, class Orientation>
+int merge(Point<T> subSetA[], int sizeA, int indexRightMostA, Point<T> subSetB[], int sizeB, int indexRightMostB,
+	Point<T> mergeSet[], int &indexRightMost, const Orientation &turn)
+{
+	/* Declarations for indices */
+	int upperTanPinA, upperTanPinB, lowerTanPinA, lowerTanPinB;
+	const int indexLeftMostB = 0;
+	
+	writedbg("Points of subsetA sorted in clockwise: ");
+	printArrayDbg(subSetA, sizeA);
+	writedbg("Points of subsetB sorted in clockwise: ");
+	printArrayDbg(subSetB, sizeB);
+	
+	//calculate lower and upper tangents, always with exact tests: with the tolerance of turn(), almost collinear
+	//vertices (e.g. of a float grid) can be taken as a straight line from one of them and as a turn from the
+	//other, so the tangent points could be wrong or move round and round forever.
+	//Even so, the subsets built with the tolerance of turn could be not exactly convex: if the tangent points are
+	//not found within their number of steps, the merged hull is built by monotone chain, in O(n log n) instead
+	//of O(n), and counted in HullStats::dcFallbackMerges. With exact tests it can't happen.
+	AdaptiveOrientation exact = bridgeOrientation(turn);
+	if (!lowerTangentPoints(subSetA,sizeA,subSetB,sizeB,indexRightMostA,indexLeftMostB,lowerTanPinA,lowerTanPinB,exact)
+		|| !upperTangentPoints(subSetA,sizeA,subSetB,sizeB,indexRightMostA,indexLeftMostB,upperTanPinA,upperTanPinB,exact))
+	{
+		assert(!isExactOrientation(turn) && "tangent lines of exactly convex sub-hulls not found");
+		return mergeByMonotoneChain(subSetA, sizeA, subSetB, sizeB, mergeSet, indexRightMost, turn);
+	}
+	
+	writelndbg("Tangent points of lower tangent line to both subsets are: (" << subSetA[lowerTanPinA].x()
+	<< ", " << subSetA[lowerTanPinA].y() << ") & (" 
+	<< subSetB[lowerTanPinB].x() << ", " << subSetB[lowerTanPinB].y() << ")");
+	
+	writelndbg("Tangent points of upper tangent line to both subsets are: (" << subSetA[upperTanPinA].x()
+	<< ", " << subSetA[upperTanPinA].y() << ") & (" 
+	<< subSetB[upperTanPinB].x() << ", " << subSetB[upperTanPinB].y() << ")");
+	
+	//->merge two subsets given the upper and lower tangents into mergeSet, in clockwise order from the leftmost
+	// point of subSetA: upper part of A, from B's upper tangent point to B's lower tangent point, and lower part of A.
+	int j,k;
+	int mergeSize = 0;
+
+	for (j = 0; j <= upperTanPinA; j++)
+		mergeSet[mergeSize++] = subSetA[j];
+	
+	//the rightmost point of B is the rightmost one of the merged set
+	indexRightMost = mergeSize + (indexRightMostB - upperTanPinB + sizeB) % sizeB;
+	
+	for (k = upperTanPinB; k != lowerTanPinB; k = (k+1)%sizeB)
+		mergeSet[mergeSize++] = subSetB[k];
+		
+	//we add the lower tangent point for B as well (it was the exit condition for the loop)
+	mergeSet[mergeSize++] = subSetB[k];
+	
+	//the lower part of A goes back to its leftmost point (not included, it is the first one)
+	if (lowerTanPinA > upperTanPinA)
+		for (j = lowerTanPinA; j < sizeA; j++)
+			mergeSet[mergeSize++] = subSetA[j];
+	
+	writedbg("Points of merged set: ");
+	printArrayDbg(mergeSet, mergeSize);
+		
+	return mergeSize;
+}
+
+/**
+ * Same as merge, when the tangent points couldn't be found: the merged hull is built by monotone chain of
+ * the points of both subsets. subSetA is the lower hull buffer, so it must have room for sizeA+sizeB points
+ * (in the recursion, subSetB is right after the room of subSetA).
+ * Complexity: O((sizeA + sizeB) log (sizeA + sizeB))
+ */
+template<class T, class Orientation>
+int mergeByMonotoneChain(Point<T> subSetA[], int sizeA, const Point<T> subSetB[], int sizeB, Point<T> mergeSet[],
+	int &indexRightMost, const Orientation &turn)
+{
+	writelndbg("The tangent points were not found, merging by monotone chain");
+	countFallbackMerge(turn);
+	std::copy(subSetA, subSetA + sizeA, mergeSet);
+	std::copy(subSetB, subSetB + sizeB, mergeSet + sizeA);
+	sortPoints(mergeSet, sizeA + sizeB);
+	return monotoneChainInPlace(mergeSet, sizeA + sizeB, subSetA, indexRightMost, turn);
+}
+
+/**
+ * Calculates the tangent points for the lower tanget line between subSetA and subSetB.
+ * a only moves forwards and b backwards, so they are found within sizeA+sizeB steps if both subsets are
+ * convex: if they aren't, false is returned.
+ */
+template<class T, class Orientation>
+bool lowerTangentPoints(const Point<T> subSetA[], int sizeA, const Point<T> subSetB[], int sizeB,
+ int indexRightMostA, int indexLeftMostB,
+ int &tanPinA, int &tanPinB, const Orientation &turn)
+{
+	writelndbg("Calculating the lower tanget points...");
+	
+	bool noLowerTangentToA;
+	bool noLowerTangentToB;
+	
+	int a = indexRightMostA; 
+	int b = indexLeftMostB;
+	int steps = sizeA + sizeB;
+	
+	writelndbg("index right most a:" << a << "- values :" << subSetA[a].x() << ", "<< subSetA[a].y());
+	writelndbg("index left most b:" << b << "- values :" << subSetB[b].x() << ", "<< subSetB[b].y());
+	
+	do
+	{
+		noLowerTangentToA = !isLowerTangent(subSetA[a],subSetB[b],subSetA[(a+1)%sizeA],true,turn);
+		while (noLowerTangentToA)
+		{
+			writelndbg("  incr a ");
+			if (--steps < 0)
+				return false;
+			a = (a+1)%sizeA;
+			noLowerTangentToA = !isLowerTangent(subSetA[a],subSetB[b],subSetA[(a+1)%sizeA],true,turn);
+		}
+		
+		noLowerTangentToB = !isLowerTangent(subSetA[a],subSetB[b],subSetB[(b+sizeB-1)%sizeB],false,turn);
+		while (noLowerTangentToB)
+		{
+			writelndbg("  decr b");
+			if (--steps < 0)
+				return false;
+			b = (b+sizeB-1)%sizeB;
+			noLowerTangentToB = !isLowerTangent(subSetA[a],subSetB[b],subSetB[(b+sizeB-1)%sizeB],false,turn);
+		}
+		
+		noLowerTangentToA = !isLowerTangent(subSetA[a],subSetB[b],subSetA[(a+1)%sizeA],true,turn);//b changed, so previously islowertangent isn't valid
+		
+	} while ( noLowerTangentToA || noLowerTangentToB);
+	
+	tanPinA = a;
+	tanPinB = b;
+	
+	writelndbg("");
+	writelndbg("These are the lower tangent points: subsetA[" << a << "], subsetB[" << b << "]");
+	
+	return true;
+}
+
+/**
+ * Check if next (the neighbour of p1 in subset A, or of p2 in subset B, in the direction the tangent
+ * point is moving) is farther than the tangent point in the line defined by p1 and p2.
+ * Then the tangent point would be in the middle of the tangent line and it has to move to next.
+ * The sign is right with any orientation predicate: the points are in a line, so both products have got
+ * the same sign and there is no cancellation.
+ */
+template<class T>
+bool isFartherInLine(const Point<T> &p1, const Point<T> &p2, const Point<T> &next, bool nextOfP1)
+{
+	typedef typename CoordinateTraits<T>::Cross Cross;
+	const Point<T> &p = nextOfP1 ? p1 : p2;
+	const Point<T> &other = nextOfP1 ? p2 : p1;
+	return (Cross) (next.x() - p.x()) * (p.x() - other.x()) + (Cross) (next.y() - p.y()) * (p.y() - other.y()) > 0;
+}
+
+/**
+ * Check if the line defined by p1 and p2 (from left to right) is lower than its subsets of points, given
+ * the neighbour (next) of the tangent point in the direction it moves (see isFartherInLine).
+ * Since the subsets are convex polygons, it is enough to check that next is over the line (left turn).
+ * Complexity: O(1)
+ */
+template<class T, class Orientation>
+bool isLowerTangent(const Point<T> &p1, const Point<T> &p2, const Point<T> &next, bool nextOfP1, const Orientation &turn)
+{
+	writelndbg("is lower tangent?");
+	
+	int side = turn(p1, p2, next);
+	bool isLineLowerThanPoint = side > 0 || (side == 0 && !isFartherInLine(p1, p2, next, nextOfP1));
+	writelndbg("islower return: " <<  isLineLowerThanPoint);
+
+	return isLineLowerThanPoint;
+}
+
+/**
+ * Calculates the tangent points for the upper tanget line between subSetA and subSetB.
+ * Like the lower ones, they are found within sizeA+sizeB steps, or false is returned.
+ */
+template<class T, class Orientation>
+bool upperTangentPoints(const Point<T> subSetA[], int sizeA, const Point<T> subSetB[], int sizeB,
+ int indexRightMostA, int indexLeftMostB,
+ int &tanPinA, int &tanPinB, const Orientation &turn)
+{
+	writelndbg("Calculating the upper tanget points...");
+	
+	bool noUpperTangentToA;
+	bool noUpperTangentToB;
+	int a = indexRightMostA;
+	int b = indexLeftMostB;
+	int steps = sizeA + sizeB;
+	
+	writelndbg("index right most a:" << a << "- values :" << subSetA[a].x() << ", "<< subSetA[a].y());
+	writelndbg("index left most b:" << b << "- values :" << subSetB[b].x() << ", "<< subSetB[b].y());
+	
+	do
+	{
+		noUpperTangentToA = !isUpperTangent(subSetA[a],subSetB[b],subSetA[(a+sizeA-1)%sizeA],true,turn);
+		while (noUpperTangentToA)
+		{
+			writelndbg("  decr a ");
+			if (--steps < 0)
+				return false;
+			a = (a+sizeA-1)%sizeA;
+			noUpperTangentToA = !isUpperTangent(subSetA[a],subSetB[b],subSetA[(a+sizeA-1)%sizeA],true,turn);
+		}
+		
+		noUpperTangentToB = !isUpperTangent(subSetA[a],subSetB[b],subSetB[(b+1)%sizeB],false,turn);
+		while (noUpperTangentToB)
+		{
+			writelndbg("  incr b ");
+			if (--steps < 0)
+				return false;
+			b = (b+1)%sizeB;
+			noUpperTangentToB = !isUpperTangent(subSetA[a],subSetB[b],subSetB[(b+1)%sizeB],false,turn);
+		}
+		
+		noUpperTangentToA = !isUpperTangent(subSetA[a],subSetB[b],subSetA[(a+sizeA-1)%sizeA],true,turn);
+	
+	} while ( noUpperTangentToA || noUpperTangentToB);
+	
+	tanPinA = a;
+	tanPinB = b;
+	writelndbg("");
+	writelndbg("These are the lower tangent points: subsetA[" << a << "], subsetB[" << b << "]");
+	return true;
+}
+
+/**
+ * Check if the line defined by p1 and p2 (from left to right) is upper than its subsets of points, given
+ * the neighbour (next) of the tangent point in the direction it moves: next has to be under the line (right turn).
+ * Complexity: O(1)
+ */
+template<class T, class Orientation>
+bool isUpperTangent(const Point<T> &p1, const Point<T> &p2, const Point<T> &next, bool nextOfP1, const Orientation &turn)
+{
+	writelndbg("is upper tangent?");
+	
+	int side = turn(p1, p2, next);
+	bool isLineUpperThanPoint = side < 0 || (side == 0 && !isFartherInLine(p1, p2, next, nextOfP1));
+	writelndbg("isUpper return: " <<  isLineUpperThanPoint);
+	
+	return isLineUpperThanPoint;
+}
+
+#endif //CH_ALGORITHMS_H
@@ -0,0 +1,181 @@
+/*
+ * HullBatch.h
+ *
+ * Descp: Convex hulls of many small sets of points in one call (e.g. the obstacles of the path planning
+ * cases, of 5 to 50 points). The sets are packed one after another in one array, with the offset of every
+ * set, and so are their hulls.
+ *
+ * For such small sets, the time of IterativeConvexHull is not in the monotone chain but around it (the
+ * options, the counter of exact tests, the heap sort...). Every set of HULL_BATCH_NETWORK_POINTS points or
+ * less is sorted by the sorting network of its size (Batcher's odd-even merge sort): a fixed sequence of
+ * branchless compare-exchanges of the keys of the points (see radix-sort.h), whatever the order of the
+ * points is. Then the hull of every set is built by monotoneChain, straight into the packed output: about 1.5
+ * times faster than IterativeConvexHull per set on 5 to 50 points (see bench_HullBatch.cpp).
+ * Bigger sets are solved one by one by IterativeConvexHull.
+ * The hulls are the same than the ones of IterativeConvexHull (same order of the points and same
+ * orientation tests, with the epsilon of turn): clockwise from the leftmost point.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#ifndef HULL_BATCH_H
+#define HULL_BATCH_H
+
+#include "../CH_Algorithms.h"
+#include <vector>
+#include <stdint.h>		// uint8_t, uint64_t
+
+//Sets of this number of points or less are sorted by a sorting network
+const int HULL_BATCH_NETWORK_POINTS = 64;
+
+/**
+ * Sets of points packed in one array: set i is points[offsets[i]..offsets[i+1])
+ */
+struct PackedPointSets
+{
+	std::vector<Point2f> points;
+	std::vector<int> offsets;
+
+	PackedPointSets() : offsets(1, 0) {}
+
+	int size() const { return offsets.size() - 1; }
+	const Point2f* set(int i) const { return points.data() + offsets[i]; }
+	int setSize(int i) const { return offsets[i+1] - offsets[i]; }
+
+	void clear()
+	{
+		points.clear();
+		offsets.assign(1, 0);
+	}
+
+	void add(const Point2f P[], int n)
+	{
+		points.insert(points.end(), P, P + n);
+		offsets.push_back(points.size());
+	}
+};
+
+/**
+ * Sorts a and b without branches
+ */
+template<class Key>
+inline void compareExchange(Key &a, Key &b)
+{
+	Key low = a < b ? a : b;
+	Key high = a < b ? b : a;
+	a = low;
+	b = high;
+}
+
+/**
+ * Comparators (pairs of positions) of the sorting networks of 0 to HULL_BATCH_NETWORK_POINTS keys.
+ * The one of n keys is Batcher's odd-even merge sort of the next power of 2, N, without the comparators of
+ * the positions from n on: if those positions are padded with the biggest key, no comparator ever moves it
+ * (a comparator only swaps a bigger key at its first position), so they would do nothing.
+ */
+inline std::vector<std::vector<uint8_t> > buildSortingNetworks()
+{
+	std::vector<std::vector<uint8_t> > networks(HULL_BATCH_NETWORK_POINTS + 1);
+	for (int n = 2; n <= HULL_BATCH_NETWORK_POINTS; n++)
+	{
+		int N = 1;
+		while (N < n)
+			N <<= 1;
+		for (int p = 1; p < N; p <<= 1)
+			for (int k = p; k >= 1; k >>= 1)
+				for (int j = k % p; j + k < N; j += 2*k)
+					for (int i = 0; i < k && i + j + k < N; i++)
+						if ((i + j) / (2*p) == (i + j + k) / (2*p) && i + j + k < n)
+						{
+							networks[n].push_back(i + j);
+							networks[n].push_back(i + j + k);
+						}
+	}
+	return networks;
+}
+
+/**
+ * The networks are built once, the first time (a local static of an inline function: one per program)
+ */
+inline const std::vector<uint8_t>& sortingNetwork(int n)
+{
+	static const std::vector<std::vector<uint8_t> > networks = buildSortingNetworks();
+	return networks[n];
+}
+
+/**
+ * Sorts n keys (HULL_BATCH_NETWORK_POINTS at most) by the sorting network of n keys
+ */
+template<class Key>
+inline void networkSort(Key keys[], int n)
+{
+	const std::vector<uint8_t> &network = sortingNetwork(n);
+	const uint8_t *comparator = network.data(), *end = comparator + network.size();
+	for (; comparator != end; comparator += 2)
+		compareExchange(keys[comparator[0]], keys[comparator[1]]);
+}
+
+/**
+ * Writes the n points of P (HULL_BATCH_NETWORK_POINTS at most) in sorted, in the same order than sortPoints
+ */
+inline void networkSortPoints(const Point2f P[], int n, Point2f sorted[])
+{
+	uint64_t keys[HULL_BATCH_NETWORK_POINTS];
+	for (int i = 0; i < n; i++)
+		keys[i] = pointToKey(P[i]);
+	networkSort(keys, n);
+	for (int i = 0; i < n; i++)
+		sorted[i] = keyToPoint<float>(keys[i]);
+}
+
+/**
+ * Convex hulls of the nSets sets of points, packed in points: set i is points[offsets[i]..offsets[i+1]).
+ * The hulls are written packed in hulls, which must have room for offsets[nSets]+nSets points: hull i is
+ * hulls[hullOffsets[i]..hullOffsets[i+1]), and hullOffsets must have room for nSets+1 offsets.
+ *
+ * Every hull is written right after the previous one: hull i starts at hulls[offsets[i]+i] at most, so there
+ * is room for its n+1 points.
+ * The points are not modified. Nothing is allocated unless there are sets of more than
+ * HULL_BATCH_NETWORK_POINTS points.
+ * Returns the number of points of all the hulls.
+ * Complexity: big theta(n log^2 n) per small set (the sorting network), big theta(n) for the hulls.
+ */
+inline int convexHullBatch(const Point2f points[], const int offsets[], int nSets, Point2f hulls[], int hullOffsets[])
+{
+	Point2f sorted[HULL_BATCH_NETWORK_POINTS];
+	std::vector<Point2f> bigSet;
+	int out = 0;
+	hullOffsets[0] = 0;
+	for (int s = 0; s < nSets; s++)
+	{
+		int n = offsets[s+1] - offsets[s];
+		if (n > HULL_BATCH_NETWORK_POINTS)
+		{
+			bigSet.assign(points + offsets[s], points + offsets[s+1]);
+			out += IterativeConvexHull(bigSet.data(), n, hulls + out);
+		}
+		else
+		{
+			networkSortPoints(points + offsets[s], n, sorted);
+			out += monotoneChain(sorted, n, hulls + out, EpsilonOrientation());
+		}
+		hullOffsets[s+1] = out;
+	}
+	return out;
+}
+
+/**
+ * Same as above, for the sets of sets. hulls is overwritten.
+ */
+inline int convexHullBatch(const PackedPointSets &sets, PackedPointSets &hulls)
+{
+	hulls.points.resize(sets.points.size() + sets.size());
+	hulls.offsets.resize(sets.size() + 1);
+	int size = convexHullBatch(sets.points.data(), sets.offsets.data(), sets.size(), hulls.points.data(), hulls.offsets.data());
+	hulls.points.resize(size);
+	return size;
+}
+
+#endif // HULL_BATCH_H
@@ -0,0 +1,94 @@
+/*
+ * bench_HullBatch.cpp
+ *
+ * Descp: Benchmark of the convex hulls of many small sets in one call (HullBatch.h) against calling
+ * IterativeConvexHull once per set, returning a vector or writing in a buffer.
+ * 
+ * Usage: bench_HullBatch [numberOfSets] [maxPointsPerSet]
+ * 	By default, 200000 sets of 5 to 50 points, like the obstacles of the path planning cases.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <stdlib.h>     /* srand, rand, atoi */
+#include "HullBatch.h"
+
+using namespace std;
+
+const int REPETITIONS = 3;
+
+/**
+ * Best time, in milliseconds, of REPETITIONS runs of hulls(), which returns the number of hull points
+ */
+template<class Hulls>
+double timeHulls(Hulls hulls, long long &nHullPoints)
+{
+	double best = 0;
+	for (int r = 0; r<REPETITIONS; r++)
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		nHullPoints = hulls();
+		double elapsed = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		if (r == 0 || elapsed < best)
+			best = elapsed;
+	}
+	return best;
+}
+
+int main(int argc, char **argv)
+{
+	int nSets = (argc > 1) ? atoi(argv[1]) : 200000;
+	int maxPoints = (argc > 2) ? atoi(argv[2]) : 50;
+	
+	srand(2014);
+	PackedPointSets sets;
+	vector<Point2f> P(maxPoints);
+	for (int s = 0; s<nSets; s++)
+	{
+		int n = min(5, maxPoints) + rand() % (maxPoints - min(5, maxPoints) + 1);
+		for (int i = 0; i<n; i++)
+			P[i] = Point2f((rand() % 200001 - 100000) / 100.0f, (rand() % 200001 - 100000) / 100.0f);
+		sets.add(P.data(), n);
+	}
+	cout << "Convex hulls of " << nSets << " sets, " << sets.points.size() << " points (best of " << REPETITIONS << ")" << endl;
+	
+	long long nHullPoints;
+	double vectorTime = timeHulls([&sets, &P]() -> long long
+	{
+		long long total = 0;
+		for (int s = 0; s<sets.size(); s++)
+		{
+			copy(sets.set(s), sets.set(s) + sets.setSize(s), P.begin());
+			total += IterativeConvexHull(P.data(), sets.setSize(s)).size();
+		}
+		return total;
+	}, nHullPoints);
+	cout << setw(32) << "IterativeConvexHull (vector): " << fixed << setprecision(2) << vectorTime << " ms, "
+		<< nHullPoints << " hull points" << endl;
+	
+	vector<Point2f> hull(maxPoints + 1);
+	double bufferTime = timeHulls([&sets, &P, &hull]() -> long long
+	{
+		long long total = 0;
+		for (int s = 0; s<sets.size(); s++)
+		{
+			copy(sets.set(s), sets.set(s) + sets.setSize(s), P.begin());
+			total += IterativeConvexHull(P.data(), sets.setSize(s), hull.data());
+		}
+		return total;
+	}, nHullPoints);
+	cout << setw(32) << "IterativeConvexHull (buffer): " << bufferTime << " ms, " << nHullPoints << " hull points" << endl;
+	
+	PackedPointSets hulls;
+	double batchTime = timeHulls([&sets, &hulls]() -> long long { return convexHullBatch(sets, hulls); }, nHullPoints);
+	cout << setw(32) << "convexHullBatch: " << batchTime << " ms, " << nHullPoints << " hull points, "
+		<< bufferTime / batchTime << "x" << endl;
+	
+	return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ * test_HullBatch.cpp
+ *
+ * Descp: To test the convex hulls of many small sets in one call (HullBatch.h header)
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: the sorting networks compared with std::sort and sortPoints, and the hulls of random, repeated and
+ * 		collinear sets compared with IterativeConvexHull.
+ * 
+ * Post: If the tests were ok or not.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>    /* sort */
+#include <cstring>      /* memcmp */
+#include <stdlib.h>     /* srand, rand */
+#include "HullBatch.h"
+
+typedef bool (*ArrayOfTests[]) (); 
+using namespace std;
+
+/**
+ * The network of every size sorts like std::sort, with and without repeated keys
+ */
+bool testSortingNetworks()
+{
+	bool equal = true;
+	for (int n = 0; n <= HULL_BATCH_NETWORK_POINTS && equal; n++)
+		for (int r = 0; r<1000 && equal; r++)
+		{
+			uint64_t keys[HULL_BATCH_NETWORK_POINTS], expected[HULL_BATCH_NETWORK_POINTS];
+			for (int i = 0; i<n; i++)
+				keys[i] = expected[i] = (r % 2 == 0) ? rand() % 8 : ((uint64_t) rand() << 32) | rand();
+			networkSort(keys, n);
+			sort(expected, expected + n);
+			equal = n == 0 || memcmp(keys, expected, n * sizeof(uint64_t)) == 0;
+		}
+	
+	//Same order than sortPoints, for every size, with negative, zero and repeated coordinates
+	for (int n = 0; n <= HULL_BATCH_NETWORK_POINTS && equal; n++)
+	{
+		vector<Point2f> P(n), sorted(n);
+		for (int i = 0; i<n; i++)
+			P[i] = Point2f(rand() % 5 - 2 + (i % 3 == 0 ? -0.0f : 0.5f), rand() % 5 - 2);
+		networkSortPoints(P.data(), n, sorted.data());
+		sortPoints(P.data(), n);
+		equal = n == 0 || memcmp(sorted.data(), P.data(), n * sizeof(Point2f)) == 0;
+	}
+	cout << "Same order than std::sort and sortPoints, " << sortingNetwork(50).size() / 2
+		<< " comparators for 50 points: " << equal << endl;
+	return equal;
+}
+
+/**
+ * convexHullBatch gives the same hulls than IterativeConvexHull one by one
+ */
+bool sameAsIterative(const PackedPointSets &sets)
+{
+	PackedPointSets expected;
+	for (int s = 0; s<sets.size(); s++)
+	{
+		vector<Point2f> P(sets.set(s), sets.set(s) + sets.setSize(s)), hull(P.size() + 1);
+		int size = IterativeConvexHull(P.data(), P.size(), hull.data());
+		expected.add(hull.data(), size);
+	}
+	
+	PackedPointSets copy(sets), hulls;
+	int size = convexHullBatch(sets, hulls);
+	bool equal = size == (int) expected.points.size() && hulls.offsets == expected.offsets
+		&& memcmp(hulls.points.data(), expected.points.data(), size * sizeof(Point2f)) == 0
+		&& copy.points.size() == sets.points.size()
+		&& memcmp(copy.points.data(), sets.points.data(), sets.points.size() * sizeof(Point2f)) == 0;
+	cout << "Same hulls than IterativeConvexHull: " << equal << endl;
+	return equal;
+}
+
+/**
+ * Random sets of up to 100 points (so some of them are not small)
+ */
+bool testRandomSets()
+{
+	PackedPointSets sets;
+	for (int s = 0; s<5000; s++)
+	{
+		int n = (s % 10 == 0) ? rand() % 100 : 3 + rand() % 48;
+		vector<Point2f> P(n);
+		for (int i = 0; i<n; i++)
+			P[i] = Point2f((rand() % 200001 - 100000) / 1000.0f, (rand() % 200001 - 100000) / 1000.0f);
+		sets.add(P.data(), n);
+	}
+	cout << sets.size() << " sets, " << sets.points.size() << " points" << endl;
+	return sameAsIterative(sets);
+}
+
+/**
+ * Empty sets, repeated points, collinear points, and points in a small grid (many of them collinear)
+ */
+bool testDegenerateSets()
+{
+	PackedPointSets sets;
+	for (int s = 0; s<3000; s++)
+	{
+		int n = rand() % 65;
+		vector<Point2f> P(n);
+		for (int i = 0; i<n; i++)
+		{
+			switch (s % 4)
+			{
+				case 0: P[i] = Point2f(1.5f, -2); break;									//the same point
+				case 1: { float t = rand() % 20; P[i] = Point2f(t, 2*t - 1); break; }		//a line
+				case 2: P[i] = Point2f(rand() % 3, 0.5f); break;							//horizontal line
+				default: P[i] = Point2f(rand() % 4, rand() % 4); break;					//grid
+			}
+		}
+		sets.add(P.data(), n);
+	}
+	return sameAsIterative(sets);
+}
+
+/**
+ * A square with points inside it and on its edges: its hull is just the 4 corners, clockwise from the leftmost
+ */
+bool testSquare()
+{
+	const Point2f square[] = {Point2f(1, 1), Point2f(0, 0), Point2f(2, 0), Point2f(0.5f, 0.5f), Point2f(2, 2),
+		Point2f(0, 2), Point2f(1, 0), Point2f(2, 1), Point2f(1.5f, 0.25f)};
+	PackedPointSets sets, hulls;
+	sets.add(square, 9);
+	sets.add(square, 0);
+	sets.add(square + 1, 2);
+	
+	int size = convexHullBatch(sets, hulls);
+	return size == 6 && hulls.size() == 3 && hulls.setSize(0) == 4 && hulls.setSize(1) == 0 && hulls.setSize(2) == 2
+		&& samePoint(hulls.set(0)[0], Point2f(0, 0)) && samePoint(hulls.set(0)[1], Point2f(0, 2))
+		&& samePoint(hulls.set(0)[2], Point2f(2, 2)) && samePoint(hulls.set(0)[3], Point2f(2, 0))
+		&& samePoint(hulls.set(2)[0], Point2f(0, 0)) && samePoint(hulls.set(2)[1], Point2f(2, 0));
+}
+
+int main(int argc, char **argv)
+{
+	int failedTests = 0;
+	srand(2014);
+	cout << "Testing the batch of convex hulls..." << endl << endl;
+	
+	ArrayOfTests tests = {testSortingNetworks,testRandomSets,testDegenerateSets,testSquare};
+	
+	for (int i = 0; i<4; i++)
+	{
+		cout << "Starting test number " << i+1 << endl;
+		if (tests[i]())
+			cout << "The test " << i+1 << " was successfully passed!" << endl;
+		else
+		{
+			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
+		cout << "==================================================" << endl << endl;
+	}
+	
+	return failedTests > 0 ? 1 : 0;
+}
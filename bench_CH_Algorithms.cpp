@@ -0,0 +1,90 @@
+/*
+ * bench_CH_Algorithms.cpp
+ *
+ * Descp: Benchmark to choose the cutoff of the divide and conquer algorithm: the number of points below which
+ * a set is solved by monotone chain instead of being split again (HullOptions::dcCutoff).
+ * It times the recursion (without sorting) over random points for every cutoff from 3 (no monotone chain)
+ * to 4096, and prints the fastest one for this machine. It becomes the default cutoff of the build when it is
+ * given to CMake: -DCONVEXHULL_DC_CUTOFF=<cutoff>.
+ *
+ * Usage: bench_CH_Algorithms [numberOfPoints]
+ * 	By default, 1000000 points.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <stdlib.h>     /* srand, rand, atoi */
+#include "CH_Algorithms.h"
+
+using namespace std;
+
+const int REPETITIONS = 5;
+const int MAX_CUTOFF = 4096;
+
+/**
+ * Best time, in milliseconds, of the divide and conquer recursion over a copy of the sorted points
+ */
+double timeDAndC(const vector<Point2f> &sorted, int cutoff, int &hullSize)
+{
+	int n = sorted.size();
+	vector<Point2f> buffer(2*n);
+	double best = 0;
+	for (int r = 0; r<REPETITIONS; r++)
+	{
+		copy(sorted.begin(), sorted.end(), buffer.begin());
+		int indexRightMost;
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		hullSize = DAndCRecursive(buffer.data(), n, buffer.data() + n, indexRightMost, cutoff, EpsilonOrientation());
+		double elapsed = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		if (r == 0 || elapsed < best)
+			best = elapsed;
+	}
+	return best;
+}
+
+int main(int argc, char **argv)
+{
+	int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+
+	srand(2014);
+	vector<Point2f> sorted(n);
+	for (int i = 0; i<n; i++)
+		sorted[i] = Point2f((rand() % 2000001 - 1000000) / 100.0f, (rand() % 2000001 - 1000000) / 100.0f);
+	sortPoints(sorted.data(), n);
+
+	cout << "Divide and conquer over " << n << " random points (sorting not included)" << endl << endl;
+
+	int hullSize;
+	double splitTime = timeDAndC(sorted, 3, hullSize);
+	int bestCutoff = 3;
+	double bestTime = splitTime;
+
+	cout << setw(8) << "cutoff" << setw(14) << "time" << setw(10) << "speedup" << endl;
+	cout << setw(8) << 3 << setw(11) << fixed << setprecision(2) << splitTime << " ms" << setw(9) << 1.0 << "x" << endl;
+	for (int cutoff = 4; cutoff <= MAX_CUTOFF; cutoff *= 2)
+	{
+		int cutoffHullSize;
+		double elapsed = timeDAndC(sorted, cutoff, cutoffHullSize);
+		cout << setw(8) << cutoff << setw(11) << elapsed << " ms" << setw(9) << splitTime / elapsed << "x";
+		if (cutoffHullSize != hullSize)
+			cout << "  (different convex hull!)";
+		cout << endl;
+
+		if (elapsed < bestTime)
+		{
+			bestTime = elapsed;
+			bestCutoff = cutoff;
+		}
+	}
+
+	cout << endl << "Best cutoff for this machine: " << bestCutoff << " (HullOptions::dcCutoff, by default "
+		<< DC_MONOTONE_CUTOFF << ")" << endl;
+	cout << "To build it in as the default: cmake -DCONVEXHULL_DC_CUTOFF=" << bestCutoff << " ..." << endl;
+
+	return 0;
+}
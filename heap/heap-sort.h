@@ -0,0 +1,120 @@
+/*
+ * heap-sort.h
+ *
+ * Descp: Sorting algorithm using a heap.
+ * 
+ * Complexity: O(nlogn)
+ * 
+ * Version 1.1 :
+ * 		->In-place sort over the caller's array (no heap object, no second buffer).
+ * 		  The array is turned into a maxheap in O(n), as the heap(const T array[], n) constructor does,
+ * 		  and the max. is moved to the end of the array n-1 times.
+ * 		->Bottom-up extraction (Floyd): the hole left by the root goes down to a leaf following the
+ * 		  greatest children, and then the element goes up from there. It is about half the comparisons
+ * 		  of the classic heapify, since the element to place usually belongs close to the leaves.
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: sequence of ints to sort
+ * 	formally: array of n ints
+ * 
+ * Post: ints already sorted, from less to most.
+ * 	formally: for (i:= 1; i<n-1)
+ * 				[i-1] <= [i] <= [i+1] 
+ *
+ ******************************************************************************
+ *  Created on: 09-03-2014
+ *      Author: Abel Serrano
+ */
+
+#ifndef heap_sort_h
+#define heap_sort_h
+
+#include "heap.h"
+
+/*
+ * The maxheap is stored in toSort[0]...toSort[n-1], following this:
+ * 	For a node i:
+ *	• left child is [2i+1]
+ *	• right child at [2i+2]
+ *	• parent is [(i-1)/2]
+ */
+
+/**
+ * Same as heap<T>::heapify, but for a maxheap stored in the first n elements of an array.
+ * Pre: A subtree is a heap, except for the node in the argument, which is looking its place up to down
+ * Post: A subtree which is a heap
+ */
+template<typename T>
+inline void heapifyMax(T toSort[], const int n, const int subtreeRoot, T temp)
+{
+	int i = subtreeRoot;
+	bool heap_property = false;
+	
+	while (2*i+1 < n && !heap_property)	//heapifying if we are not in the leaves and heap property is not accomplished
+	{
+		int max = 2*i+1;								//index of the max between left and right children
+		if (max+1 < n && toSort[max+1] > toSort[max])	//if there is right child and it is greater than left
+			++max;
+		
+		heap_property = !(toSort[max] > temp);	//heap property := temp is greater or equal than max of its children
+		if (!heap_property)
+		{
+			toSort[i] = toSort[max];		//max. child go up one level
+			i = max;
+		}
+	}
+	
+	toSort[i] = temp;
+}
+
+/**
+ * Places temp in a maxheap of n elements whose root (toSort[0]) is a hole.
+ * 1) The hole goes down to a leaf, following the greatest child (one comparison per level).
+ * 2) temp goes up from that leaf until its parent is not lower than it.
+ */
+template<typename T>
+inline void siftDownBottomUp(T toSort[], const int n, T temp)
+{
+	int i = 0;
+	
+	while (2*i+2 < n)	//both children
+	{
+		int max = (toSort[2*i+2] > toSort[2*i+1]) ? 2*i+2 : 2*i+1;
+		toSort[i] = toSort[max];
+		i = max;
+	}
+	if (2*i+1 < n)		//only left child
+	{
+		toSort[i] = toSort[2*i+1];
+		i = 2*i+1;
+	}
+	
+	while (i > 0 && temp > toSort[(i-1)/2])
+	{
+		toSort[i] = toSort[(i-1)/2];
+		i = (i-1)/2;
+	}
+	
+	toSort[i] = temp;
+}
+
+template<typename T>
+void heapSort(T toSort[], int n)
+{
+	//Build the maxheap in O(n): leafs are already subheaps, so we merge them upwards
+	for (int parentIndex = n/2 - 1; parentIndex >= 0; --parentIndex)
+		heapifyMax(toSort, n, parentIndex, toSort[parentIndex]);
+	
+	//Move the max. to the end of the heap, which is the end of the sorted part of the array
+	for (int last = n-1; last > 0; --last)
+	{
+		T lastElement = toSort[last];
+		toSort[last] = toSort[0];
+		siftDownBottomUp(toSort, last, lastElement);
+	}
+	return;
+}
+
+#endif //heap_sort_h
@@ -13,6 +13,9 @@
  * Version 1.2 :
  * 		->No swaps needed since we can compare the elements before to find the right place in the heap.
  * 		->Constructor of a heap with n elements from an array (no heap) in O(n)
+ * Version 1.3 :
+ * 		->Container is a contiguous growable array (std::vector) instead of a fixed one of MAX_HEAP elements.
+ * 		->reserve/capacity functions, so the container can be sized once and no reallocations are done.
  * 
  * Note that, in order to use compound data types (struct or class) for this template
  * class, you must overload the following operators:
@@ -28,14 +31,13 @@
 #ifndef heap_h
 #define heap_h
 
+#include <vector>
+
 template <class T>
 class heap
 {
 	public:
 	
-	//maximum elements in the heap
-	const static int MAX_HEAP = 30;
-	
 	//default constructor:
 	heap();
 	//copy constructor:
@@ -49,18 +51,22 @@ class heap
 	void insert(const T& x);
 	T deleteMin();
 	bool isEmpty() const;
+	int size() const;
+	
+	//Reserves room for n elements, so the next n inserts don't reallocate the container
+	void reserve(const int n);
+	//Number of elements the heap can hold without reallocating
+	int capacity() const;
 	
 	private:
-	union {			//last stored in cont[0] for saving memory
-		int last;
-		T cont[MAX_HEAP+1]; 
-	};
+	int last;
+	std::vector<T> cont;	//cont[0] is not used, the heap is stored in cont[1]...cont[last]
 	
 	//Pre: for all i <> j in h, isheap(i); i.e. j doesn't accomplish heap property 
 	void heapify(const int subtreeRoot, T temp);
 	//Post: isheap(root)
 };
 
-#include "heap_v2.cpp"
+#include "heap_v2.h"
 
 #endif //heap_h
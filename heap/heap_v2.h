@@ -1,5 +1,5 @@
 /*
- * heap.cpp
+ * heap_v2.h
  * 
  * This is the implementation file with the c++ code for the operations for this ADT.
  * The heap is implemented with an array, following this:
@@ -19,25 +19,24 @@
  * Some possible improvements from the Classes & Data structures in c++ book:
  * 		->No swaps needed since we can compare the elements before to find the right place in the heap.
  * 		->Constructor of a heap with n elements from an array (no heap) in O(n)
+ * Version 1.3 :
+ * 		->The container grows on demand. It always holds last+1 elements (cont[0] is a dummy one),
+ * 		  so insert and deleteMin are just a push_back and a pop_back on it.
  ******************************************************************************
  *  Created on: 13-03-2014
  *      Author: Abel Serrano
  */
 
-using namespace std;
-
 template <class T>
-heap<T>::heap()
+heap<T>::heap() : cont(1)
 {
 	last=0;
 }
 
 template <class T>
-heap<T>::heap(const heap& otherHeap)
+heap<T>::heap(const heap& otherHeap) : cont(otherHeap.cont)
 {
 	last = otherHeap.last;
-	for (int i = 1; i<=last; ++i)
-		this->cont[i] = otherHeap.cont[i];
 }
 
 /**
@@ -54,7 +53,7 @@ void heap<T>::heapify(const int subtreeRoot, T temp)
 	while (i<=last/2 && !heap_property)	//heapifying if we are not in the leaves and heap property is not accomplished
 	{
 		int min; //index of the min between left and right children
-		if (!(cont[2*i]>cont[2*i+1]) || (2*i == last))	//if left is lower or equal than right or there is no right child
+		if ((2*i == last) || !(cont[2*i]>cont[2*i+1]))	//if there is no right child or left is lower or equal than right
 			min =  2*i;									//min is the left child
 		else
 			min = 2*i+1;								//else, min is the right child.
@@ -77,8 +76,9 @@ heap<T>::heap(const T array[], const int n)
 {
 	/* Copying array content into the heap array container */
 	last=n;
-	for (int i = 0, j = 1; i<n; i++, j++ )
-		cont[j] = array[i];
+	cont.reserve(n+1);
+	cont.push_back(T());
+	cont.insert(cont.end(), array, array + n);
 	
 	/* Variables definition */
 	int parentIndex;
@@ -99,7 +99,7 @@ heap<T>::heap(const T array[], const int n)
  * It's one assignment instruction the difference, but, be aware that now we are storing any data type,
  * since simple integers until long data structures, as long as they have implemented the > operator.*/
 /*template <class T>
-static void swap_heap(T& x, T& y)
+inline void swap_heap(T& x, T& y)
 {
 	T temp = x;
 	x = y;
@@ -111,6 +111,7 @@ template <class T>
 void heap<T>::insert(const T& x)
 {
 	++last;
+	cont.push_back(x);	//make room for the new element (it grows the container only if it is full)
 	
 	int i = last;
 	while (i>1 && cont[i/2]>x)	//looking for the right place for x
@@ -127,7 +128,9 @@ T heap<T>::deleteMin()
 	T root = cont[1];
 	T lastElement = cont[last];	//temporal storing of the previous last element
 	last--;
-	heapify(1,lastElement);
+	cont.pop_back();
+	if (last > 0)
+		heapify(1,lastElement);
 	
 	return root;
 }
@@ -138,6 +141,24 @@ bool heap<T>::isEmpty() const
 	return !last;
 }
 
+template <class T>
+int heap<T>::size() const
+{
+	return last;
+}
+
+template <class T>
+void heap<T>::reserve(const int n)
+{
+	cont.reserve(n+1);	//+1 for the unused cont[0]
+}
+
+template <class T>
+int heap<T>::capacity() const
+{
+	return cont.capacity() - 1;
+}
+
 template <class T>
 bool heap<T>::operator==(const heap<T>& h2) const
 {
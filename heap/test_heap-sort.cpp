@@ -1,7 +1,7 @@
 /*
  * test_heap-sort.cpp
  *
- * Descp: To test sorting by heaps (heap-sort.cpp source file)
+ * Descp: To test sorting by heaps (heap-sort.h header)
  *
  ******************************************************************************
  *
@@ -16,7 +16,9 @@
  */
 
 #include <iostream>
-#include "heap-sort.cpp"
+#include <stdlib.h>     /* srand, rand */
+#include <algorithm>	/* std::sort, to check the output */
+#include "heap-sort.h"
 
 using namespace std;
 
@@ -41,7 +43,7 @@ bool test(int numbers[], int arraySolution[], int n)
 	cout << endl;
 	heapSort<int>(numbers,n);
 	cout << "Sorted!:" << endl;
-	for (int i = 0; i<n && i<heap<int>::MAX_HEAP; i++)
+	for (int i = 0; i<n; i++)
 		cout << numbers[i] << ", ";
 	cout << endl;
 	return areEqualArrays(numbers,arraySolution,n);
@@ -55,7 +57,7 @@ bool test_floats(float numbers[], float arraySolution[], int n)
 	cout << endl;
 	heapSort<float>(numbers,n);
 	cout << "Sorted!:" << endl;
-	for (int i = 0; i<n && i<heap<float>::MAX_HEAP; i++)
+	for (int i = 0; i<n; i++)
 		cout << numbers[i] << ", ";
 	cout << endl;
 	return areEqualArrays(numbers,arraySolution,n);
@@ -70,7 +72,7 @@ bool test_floats_explicit_array(float numbers[],  float arraySolution[], int n)
 	
 	heapSort<float>(numbers,n);
 	cout << "Sorted!:" << endl;
-	for (int i = 0; i<n && i<heap<float>::MAX_HEAP; i++)
+	for (int i = 0; i<n; i++)
 		cout << numbers[i] << ", ";
 	cout << endl;
 	
@@ -80,19 +82,26 @@ bool test_floats_explicit_array(float numbers[],  float arraySolution[], int n)
 
 int main(int argc, char **argv)
 {
+	int failedTests = 0;
 	int array1[] = {8,14,2,3,23,-2};
 	int array1Solution[] = {-2,2,3,8,14,23}; 
 	if (test(array1,array1Solution,6))
 		cout << "Test 1 was ok" << endl;
 	else
+	{
 		cout << "test 1 not passed" << endl;
+		failedTests++;
+	}
 	
 	int array2[] = {1,1,1,1,2,0,3,3,3,0};
 	int array2Solution[] = {0,0,1,1,1,1,2,3,3,3}; 
 	if (test(array2,array2Solution,10))
 		cout << "Test 2 was ok" << endl;
 	else
+	{
 		cout << "test 2 not passed" << endl;
+		failedTests++;
+	}
 	
 	cout << "Now, go ahead with sorting floats: " << endl;
 	float array3[] = {12.45f,0.004f,5.87f,5.86f,5.865f,-0.34f};
@@ -100,19 +109,68 @@ int main(int argc, char **argv)
 	if (test_floats(array3,array3Solution,6))
 		cout << "Test 3 was ok" << endl;
 	else
+	{
 		cout << "test 3 not passed" << endl;
+		failedTests++;
+	}
 	
 	float array4[8];
 	array4[0] = 0.0f;
-	for (int i = 0,j = 1; i<8; i++, j++)
+	for (int i = 0,j = 1; i<6; i++, j++)
 		array4[j] = array3[i];
 	array4[7] = 54.5f;
 	float array4Solution[] = {-0.34f,0.0f,0.004f,5.86f,5.865f,5.87f,12.45f,54.5f};
 	if (test_floats_explicit_array(array4,array4Solution,8))
 		cout << "Test 4 was ok" << endl;
 	else
+	{
 		cout << "test 4 not passed" << endl;
+		failedTests++;
+	}
+	
+	//More elements than the old fixed heap container (it only sorted the first 30 ones)
+	const int N_BIG = 1000;
+	int array5[N_BIG], array5Solution[N_BIG];
+	for (int i = 0; i<N_BIG; i++)
+	{
+		array5[i] = (i * 7919) % N_BIG;	//permutation of 0..N_BIG-1, since 7919 is prime
+		array5Solution[i] = i;
+	}
+	heapSort<int>(array5,N_BIG);
+	if (areEqualArrays(array5,array5Solution,N_BIG))
+		cout << "Test 5 was ok" << endl;
+	else
+	{
+		cout << "test 5 not passed" << endl;
+		failedTests++;
+	}
+	
+	//Random numbers with a lot of repeated values
+	int array6[N_BIG], array6Solution[N_BIG];
+	for (int i = 0; i<N_BIG; i++)
+		array6[i] = array6Solution[i] = rand() % 50 - 25;
+	sort(array6Solution, array6Solution + N_BIG);
+	heapSort<int>(array6,N_BIG);
+	if (areEqualArrays(array6,array6Solution,N_BIG))
+		cout << "Test 6 was ok" << endl;
+	else
+	{
+		cout << "test 6 not passed" << endl;
+		failedTests++;
+	}
+	
+	//Corner cases: empty array and one element
+	int array7[] = {5};
+	heapSort<int>(array7,0);
+	heapSort<int>(array7,1);
+	if (array7[0] == 5)
+		cout << "Test 7 was ok" << endl;
+	else
+	{
+		cout << "test 7 not passed" << endl;
+		failedTests++;
+	}
 	
-	return 0;
+	return failedTests > 0 ? 1 : 0;
 }
 
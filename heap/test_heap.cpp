@@ -162,9 +162,10 @@ bool test5()
 	// Random numbers test (hard tests start here)
 	cout << "-->Now we go with random numbers<--" << endl;
 	heap<int> h1;
+	const int N_RANDOM = 30;
 	
-	int randomArray[heap<int>::MAX_HEAP];
-	for (int i = 0; i<heap<int>::MAX_HEAP; i++)
+	int randomArray[N_RANDOM];
+	for (int i = 0; i<N_RANDOM; i++)
 	{
 		int randn = rand() % 100 + 1; // randn in the range from 1 to 100
 		randomArray[i] = randn;
@@ -173,15 +174,44 @@ bool test5()
 	
 	printHeap(h1);
 	
-	heap<int> h1Array(randomArray, heap<int>::MAX_HEAP);
+	heap<int> h1Array(randomArray, N_RANDOM);
 	printHeap(h1Array);
 	
 	assert (h1 == h1Array);
 	return true;
 }
 
+/**
+ * Test with more elements than the old fixed container (30) and the reserve/capacity functions
+ */
+bool test6()
+{
+	const int N_RANDOM = 1000;
+	heap<int> h;
+	h.reserve(N_RANDOM);
+	int capacity = h.capacity();
+	assert (capacity >= N_RANDOM);
+	
+	for (int i = 0; i<N_RANDOM; i++)
+		h.insert(rand() % 100000);
+	assert (h.size() == N_RANDOM);
+	assert (h.capacity() == capacity);	//no reallocation was done
+	
+	int previous = h.deleteMin();
+	bool sorted = true;
+	while (!h.isEmpty() && sorted)
+	{
+		int next = h.deleteMin();
+		sorted = previous <= next;
+		previous = next;
+	}
+	cout << "Extracted " << N_RANDOM << " elements in order: " << sorted << endl;
+	return sorted && h.size() == 0;
+}
+
 int main(int argc, char **argv)
 {
+	int failedTests = 0;
 	time_t timer, beginning_time = time(NULL);
 	
 	/* initialize random seed: */
@@ -194,8 +224,8 @@ int main(int argc, char **argv)
 	//bool *test() []; => function returning and array of bool pointers => ILLEGAL
 	// bool *test[]() => array of functions returning a bool pointer => ILLEGAL
 	
-	ArrayOfTests tests = {test0,test1,test2,test3,test4,test5}; /* No need to put &test1 since the standard says that a function name in this context is converted to the address of the function */
-	const int NUM_TESTS = 6;
+	ArrayOfTests tests = {test0,test1,test2,test3,test4,test5,test6}; /* No need to put &test1 since the standard says that a function name in this context is converted to the address of the function */
+	const int NUM_TESTS = 7;
 	
 	for (int i = 0; i<NUM_TESTS; i++)
 	{
@@ -203,7 +233,10 @@ int main(int argc, char **argv)
 		if (tests[i]())
 			cout << "The test " << i+1 << " was successfully passed!" << endl;
 		else
+		{
 			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
 		cout << "==================================================" << endl << endl;
 	}
 	
@@ -212,6 +245,6 @@ int main(int argc, char **argv)
 	timer = difftime(time(NULL),beginning_time);
 	cout << "Seconds elapsed for this test: " << timer << endl;
 	
-	return 0;
+	return failedTests > 0 ? 1 : 0;
 	
 }
@@ -0,0 +1,83 @@
+/*
+ * bench_orientation.cpp
+ *
+ * Descp: Benchmark of the batch orientation tests (orientation.h) against calling turn() once per point.
+ * 
+ * Usage: bench_orientation [numberOfPoints]
+ * 	By default, 10000000 points.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <stdlib.h>     /* srand, rand, atoi */
+#include "../point/Point.h"
+#include "../point/PointSet.h"
+#include "orientation.h"
+
+using namespace std;
+
+const int REPETITIONS = 5;
+const char* LEVEL_NAMES[] = {"scalar", "SSE2", "AVX2", "AVX-512"};
+
+int main(int argc, char **argv)
+{
+	int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+	
+	srand(2014);
+	vector<Point2f> points(n);
+	for (int i = 0; i<n; i++)
+		points[i] = Point2f((rand() % 2000001 - 1000000) / 100.0f, (rand() % 2000001 - 1000000) / 100.0f);
+	PointSet columns(points.data(), n);
+	vector<signed char> result(n);
+	Point2f A(-5000.5f, 120.25f), B(7000.75f, -333.5f);
+	
+	cout << "Orientation of " << n << " points (best of " << REPETITIONS << ")" << endl;
+	
+	double turnTime = 0;
+	long long checksum = 0;
+	for (int r = 0; r<REPETITIONS; r++)
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		for (int i = 0; i<n; i++)
+			result[i] = turn(A, B, points[i]);
+		double elapsed = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		checksum += result[n/2];
+		if (r == 0 || elapsed < turnTime)
+			turnTime = elapsed;
+	}
+	cout << setw(24) << "turn() per point: " << fixed << setprecision(2) << turnTime << " ms" << endl;
+	
+	for (int level = SIMD_SCALAR; level <= supportedSimdLevel(); level++)
+	{
+		setSimdLevel((SimdLevel) level);
+		double columnsTime = 0, pointsTime = 0;
+		for (int r = 0; r<REPETITIONS; r++)
+		{
+			chrono::steady_clock::time_point start = chrono::steady_clock::now();
+			orientationBatch(A, B, columns.x(), columns.y(), n, result.data());
+			double elapsed = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+			if (r == 0 || elapsed < columnsTime)
+				columnsTime = elapsed;
+			
+			start = chrono::steady_clock::now();
+			orientationBatch(A, B, points.data(), n, result.data());
+			elapsed = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+			if (r == 0 || elapsed < pointsTime)
+				pointsTime = elapsed;
+			checksum += result[n/2];
+		}
+		cout << setw(10) << LEVEL_NAMES[level] << " (PointSet): " << columnsTime << " ms, "
+			<< turnTime / columnsTime << "x" << endl;
+		cout << setw(10) << LEVEL_NAMES[level] << " (Point2f[]): " << pointsTime << " ms, "
+			<< turnTime / pointsTime << "x" << endl;
+	}
+	
+	cout << "(checksum " << checksum << ")" << endl;
+	return 0;
+}
@@ -0,0 +1,464 @@
+/*
+ * orientation.h
+ *
+ * Descp: Orientation tests: on which side of the directed line A->B is a point C.
+ * 
+ * turn() classifies one point. orientationBatch() classifies a whole block of points against the same
+ * line, using the widest SIMD instructions of the machine (AVX-512, AVX2 or SSE2), chosen at runtime.
+ * It gives exactly the same result than turn() for every point: the cross product is computed the same way
+ * (float differences, double products) and compared with the same epsilon. This holds as long as the
+ * compiler doesn't contract t1 - t2 into a fused multiply-add (-ffp-contract=off, the default of the
+ * -std=c++XX modes of g++).
+ *
+ * turnAdaptive() is the exact test, without tolerance: the cross product is computed in double with
+ * an error bound (Shewchuk's filter), and only when the result is smaller than the bound (the points are
+ * collinear or almost) it is computed again exactly by turnExact(), which is much slower.
+ * The convex hull algorithms are templates of the predicate: EpsilonOrientation or AdaptiveOrientation.
+ *
+ * turn() and turnAdaptive() are templates of the coordinate type too (see CoordinateTraits in Point.h).
+ * With integer coordinates, turn() is already exact: the cross product is computed in 64 or 128 bits
+ * integers and its sign is taken without branches, so it doesn't need turnAdaptive. orientationBatch is only
+ * for float points.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#ifndef orientation_h
+#define orientation_h
+
+#include "../point/Point.h"
+#include <atomic>
+#include <cmath> //for fabs, fma
+#include <cstddef> //for NULL
+
+//Cross products whose absolute value is lower than this are considered 0 (straight line)
+const double ORIENTATION_EPSILON = 0.0000001;
+
+//Instruction sets for orientationBatch
+enum SimdLevel { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2, SIMD_AVX512 };
+
+/**
+ * Sign of a cross product: with the epsilon for floating point coordinates (double), exact for integer ones
+ */
+inline int crossProductSign(double result)
+{
+	if (result > ORIENTATION_EPSILON)
+		return 1;
+		
+	else if (result < -ORIENTATION_EPSILON)
+		return -1;
+		
+	else
+		return 0;
+}
+
+inline int crossProductSign(int64_t result)
+{
+	return (result > 0) - (result < 0);
+}
+
+inline int crossProductSign(int128_t result)
+{
+	return (result > 0) - (result < 0);
+}
+
+/**
+ * Returns 1 if ABC forms a left turn
+ * Returns -1 if ABC forms a right turn
+ * Returns 0 if ABC forms a straight line
+ */
+template<class T>
+inline int turn(const Point<T>& A,const Point<T>& B,const Point<T>& C)
+{
+	typedef typename CoordinateTraits<T>::Cross Cross;
+	Cross t1,t2;
+	
+	//Calculates cross product for the three points (differences in T, products in Cross)
+	t1 = (Cross) (B.x() - A.x()) * (C.y() - A.y());
+	t2 = (Cross) (B.y() - A.y()) * (C.x() - A.x());
+	
+	return crossProductSign(t1 - t2);
+}
+
+/**
+ * Same result than turn, but exact (no epsilon): 0 only if A, B and C are exactly in a straight line.
+ * Every product of two floats is exact in double, so the cross product is the sum of 6 exact products,
+ * which is added without rounding errors as an expansion (a sum of doubles which don't overlap).
+ * With double coordinates, every product is split in two doubles (the rounded product and its error), so
+ * the expansion has got 12 terms. It is exact unless a product overflows or underflows.
+ * Integer coordinates are exact with turn().
+ * Complexity: O(1), but about 20 times slower than turn
+ */
+inline int turnExact(const Point2f& A,const Point2f& B,const Point2f& C);
+inline int turnExact(const Point2d& A,const Point2d& B,const Point2d& C);
+
+template<class T>
+inline int turnExact(const Point<T>& A,const Point<T>& B,const Point<T>& C)
+{
+	static_assert(CoordinateTraits<T>::exact, "turnExact of floating point coordinates is not a template");
+	return turn(A, B, C);
+}
+
+//Relative error bound of the cross product computed in double (Shewchuk's ccwerrboundA): (3 + 16e)e, e = 2^-53
+const double ORIENTATION_ERROR_BOUND = (3.0 + 16.0 * 1.1102230246251565e-16) * 1.1102230246251565e-16;
+
+/**
+ * Same result than turnExact, but only the points whose cross product is too small for its error bound
+ * go to turnExact (the slow path). If exactTests is not null, it counts how many times that happens.
+ * Integer coordinates don't need it: they go straight to turn, which is exact.
+ * Complexity: O(1)
+ */
+template<class T>
+inline int turnAdaptive(const Point<T>& A,const Point<T>& B,const Point<T>& C, std::atomic<long long> *exactTests = NULL)
+{
+	if (CoordinateTraits<T>::exact)
+		return turn(A, B, C);
+	
+	double detLeft = ((double) B.x() - A.x()) * ((double) C.y() - A.y());
+	double detRight = ((double) B.y() - A.y()) * ((double) C.x() - A.x());
+	double det = detLeft - detRight;
+	
+	//With different signs (or a 0) there is no cancellation, so the sign of det is right
+	if ((detLeft > 0 && detRight <= 0) || (detLeft < 0 && detRight >= 0) || detLeft == 0)
+		return (det > 0) - (det < 0);
+	
+	double errorBound = ORIENTATION_ERROR_BOUND * (std::fabs(detLeft) + std::fabs(detRight));
+	if (det > errorBound)
+		return 1;
+	else if (det < -errorBound)
+		return -1;
+	
+	if (exactTests != NULL)
+		exactTests->fetch_add(1, std::memory_order_relaxed);
+	return turnExact(A, B, C);
+}
+
+/**
+ * Orientation predicates for the convex hull algorithms: turn(), with its epsilon, or turnAdaptive()
+ */
+struct EpsilonOrientation
+{
+	template<class T>
+	int operator()(const Point<T>& A,const Point<T>& B,const Point<T>& C) const { return turn(A, B, C); }
+};
+
+struct AdaptiveOrientation
+{
+	std::atomic<long long> *exactTests;	//counter of calls to turnExact (the slow path), can be null
+	
+	explicit AdaptiveOrientation(std::atomic<long long> *exactTests = NULL) : exactTests(exactTests) {}
+	
+	template<class T>
+	int operator()(const Point<T>& A,const Point<T>& B,const Point<T>& C) const { return turnAdaptive(A, B, C, exactTests); }
+};
+
+/**
+ * result[i] = turn(A,B,(x[i],y[i])) for the n points given by columns x and y
+ */
+inline void orientationBatch(const Point2f& A, const Point2f& B, const float x[], const float y[], int n, signed char result[]);
+
+/**
+ * result[i] = turn(A,B,C[i]) for the n points of C
+ */
+inline void orientationBatch(const Point2f& A, const Point2f& B, const Point2f C[], int n, signed char result[]);
+
+/**
+ * Instruction set used by orientationBatch. By default, the best one supported by the machine.
+ * setSimdLevel can force a lower one (a higher one than supported is lowered to the supported one).
+ */
+inline SimdLevel getSimdLevel();
+inline SimdLevel setSimdLevel(SimdLevel level);
+inline SimdLevel supportedSimdLevel();
+
+/*
+ * Implementation of the batch orientation tests.
+ * 
+ * There is one kernel for every instruction set. Every kernel processes as many points as doubles fit in
+ * its vector registers twice (the float differences are converted to double before the products):
+ * 		->SSE2:    4 points per iteration (2 x 2 doubles)
+ * 		->AVX2:    8 points per iteration (2 x 4 doubles)
+ * 		->AVX-512: 16 points per iteration (2 x 8 doubles)
+ * and the last points (less than a full iteration) with the scalar code.
+ * It also has got the slow path of the exact orientation test, turnExact.
+ * The kernels for AVX2 and AVX-512 are compiled for those instruction sets by target attributes, so the
+ * rest of the program doesn't need them, and they are only called if the CPU supports them.
+ */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ORIENTATION_X86
+#include <immintrin.h>
+#endif
+
+typedef void (*OrientationKernel)(float ax, float ay, double dxAB, double dyAB,
+	const float x[], const float y[], int n, signed char result[]);
+/**
+ * The same computation than turn(), with B-A already calculated
+ */
+inline void orientationScalar(float ax, float ay, double dxAB, double dyAB,
+	const float x[], const float y[], int n, signed char result[])
+{
+	for (int i = 0; i<n; i++)
+	{
+		double cross = dxAB * (y[i] - ay) - dyAB * (x[i] - ax);
+		result[i] = (cross > ORIENTATION_EPSILON) - (cross < -ORIENTATION_EPSILON);
+	}
+}
+
+#ifdef ORIENTATION_X86
+
+__attribute__((target("sse2")))
+inline void orientationSSE2(float ax, float ay, double dxAB, double dyAB,
+	const float x[], const float y[], int n, signed char result[])
+{
+	const __m128 vax = _mm_set1_ps(ax), vay = _mm_set1_ps(ay);
+	const __m128d vdx = _mm_set1_pd(dxAB), vdy = _mm_set1_pd(dyAB);
+	const __m128d eps = _mm_set1_pd(ORIENTATION_EPSILON), minusEps = _mm_set1_pd(-ORIENTATION_EPSILON);
+	
+	int i = 0;
+	for (; i+4 <= n; i += 4)
+	{
+		__m128 cx = _mm_sub_ps(_mm_loadu_ps(x+i), vax);
+		__m128 cy = _mm_sub_ps(_mm_loadu_ps(y+i), vay);
+		
+		__m128d crossLow = _mm_sub_pd(_mm_mul_pd(vdx, _mm_cvtps_pd(cy)), _mm_mul_pd(vdy, _mm_cvtps_pd(cx)));
+		__m128d crossHigh = _mm_sub_pd(_mm_mul_pd(vdx, _mm_cvtps_pd(_mm_movehl_ps(cy,cy))),
+			_mm_mul_pd(vdy, _mm_cvtps_pd(_mm_movehl_ps(cx,cx))));
+		
+		int left = _mm_movemask_pd(_mm_cmpgt_pd(crossLow, eps)) | (_mm_movemask_pd(_mm_cmpgt_pd(crossHigh, eps)) << 2);
+		int right = _mm_movemask_pd(_mm_cmplt_pd(crossLow, minusEps)) | (_mm_movemask_pd(_mm_cmplt_pd(crossHigh, minusEps)) << 2);
+		
+		for (int k = 0; k<4; k++)
+			result[i+k] = ((left >> k) & 1) - ((right >> k) & 1);
+	}
+	
+	orientationScalar(ax, ay, dxAB, dyAB, x+i, y+i, n-i, result+i);
+}
+
+/**
+ * (-1, 0 or 1 as doubles) -> 4 ints
+ */
+__attribute__((target("avx2")))
+inline __m128i turnsToInts(__m256d cross, __m256d eps, __m256d minusEps, __m256d one)
+{
+	__m256d left = _mm256_and_pd(_mm256_cmp_pd(cross, eps, _CMP_GT_OQ), one);
+	__m256d right = _mm256_and_pd(_mm256_cmp_pd(cross, minusEps, _CMP_LT_OQ), one);
+	return _mm256_cvtpd_epi32(_mm256_sub_pd(left, right));
+}
+
+__attribute__((target("avx2")))
+inline void orientationAVX2(float ax, float ay, double dxAB, double dyAB,
+	const float x[], const float y[], int n, signed char result[])
+{
+	const __m256 vax = _mm256_set1_ps(ax), vay = _mm256_set1_ps(ay);
+	const __m256d vdx = _mm256_set1_pd(dxAB), vdy = _mm256_set1_pd(dyAB);
+	const __m256d eps = _mm256_set1_pd(ORIENTATION_EPSILON), minusEps = _mm256_set1_pd(-ORIENTATION_EPSILON);
+	const __m256d one = _mm256_set1_pd(1.0);
+	
+	int i = 0;
+	for (; i+8 <= n; i += 8)
+	{
+		__m256 cx = _mm256_sub_ps(_mm256_loadu_ps(x+i), vax);
+		__m256 cy = _mm256_sub_ps(_mm256_loadu_ps(y+i), vay);
+		
+		__m256d crossLow = _mm256_sub_pd(_mm256_mul_pd(vdx, _mm256_cvtps_pd(_mm256_castps256_ps128(cy))),
+			_mm256_mul_pd(vdy, _mm256_cvtps_pd(_mm256_castps256_ps128(cx))));
+		__m256d crossHigh = _mm256_sub_pd(_mm256_mul_pd(vdx, _mm256_cvtps_pd(_mm256_extractf128_ps(cy,1))),
+			_mm256_mul_pd(vdy, _mm256_cvtps_pd(_mm256_extractf128_ps(cx,1))));
+		
+		//4 + 4 ints -> 8 shorts -> 8 chars
+		__m128i shorts = _mm_packs_epi32(turnsToInts(crossLow, eps, minusEps, one), turnsToInts(crossHigh, eps, minusEps, one));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(result+i), _mm_packs_epi16(shorts, shorts));
+	}
+	
+	orientationScalar(ax, ay, dxAB, dyAB, x+i, y+i, n-i, result+i);
+}
+
+/**
+ * 8 floats as 8 doubles. The intrinsics without mask take an undefined register as the source of the masked
+ * lanes, which g++ 12 warns as used uninitialized, so the zero-masking ones are used with all the lanes.
+ */
+__attribute__((target("avx512f")))
+inline __m512d toDoubles(__m256 v)
+{
+	return _mm512_maskz_cvtps_pd((__mmask8) 0xFF, v);
+}
+
+__attribute__((target("avx512f")))
+inline void orientationAVX512(float ax, float ay, double dxAB, double dyAB,
+	const float x[], const float y[], int n, signed char result[])
+{
+	const __m256 vax = _mm256_set1_ps(ax), vay = _mm256_set1_ps(ay);
+	const __m512d vdx = _mm512_set1_pd(dxAB), vdy = _mm512_set1_pd(dyAB);
+	const __m512d eps = _mm512_set1_pd(ORIENTATION_EPSILON), minusEps = _mm512_set1_pd(-ORIENTATION_EPSILON);
+	
+	int i = 0;
+	for (; i+16 <= n; i += 16)
+	{
+		//Both halves are loaded apart instead of casting 512 bits to 256 (an undefined register again)
+		__m256 cxLow = _mm256_sub_ps(_mm256_loadu_ps(x+i), vax), cxHigh = _mm256_sub_ps(_mm256_loadu_ps(x+i+8), vax);
+		__m256 cyLow = _mm256_sub_ps(_mm256_loadu_ps(y+i), vay), cyHigh = _mm256_sub_ps(_mm256_loadu_ps(y+i+8), vay);
+		
+		__m512d crossLow = _mm512_sub_pd(_mm512_mul_pd(vdx, toDoubles(cyLow)),
+			_mm512_mul_pd(vdy, toDoubles(cxLow)));
+		__m512d crossHigh = _mm512_sub_pd(_mm512_mul_pd(vdx, toDoubles(cyHigh)),
+			_mm512_mul_pd(vdy, toDoubles(cxHigh)));
+		
+		__mmask16 left = _mm512_cmp_pd_mask(crossLow, eps, _CMP_GT_OQ) | (_mm512_cmp_pd_mask(crossHigh, eps, _CMP_GT_OQ) << 8);
+		__mmask16 right = _mm512_cmp_pd_mask(crossLow, minusEps, _CMP_LT_OQ) | (_mm512_cmp_pd_mask(crossHigh, minusEps, _CMP_LT_OQ) << 8);
+		
+		__m512i turns = _mm512_mask_set1_epi32(_mm512_maskz_set1_epi32(left, 1), right, -1);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(result+i), _mm512_maskz_cvtepi32_epi8((__mmask16) 0xFFFF, turns));
+	}
+	
+	orientationScalar(ax, ay, dxAB, dyAB, x+i, y+i, n-i, result+i);
+}
+
+#endif //ORIENTATION_X86
+
+inline SimdLevel supportedSimdLevel()
+{
+#ifdef ORIENTATION_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f"))
+		return SIMD_AVX512;
+	if (__builtin_cpu_supports("avx2"))
+		return SIMD_AVX2;
+	if (__builtin_cpu_supports("sse2"))
+		return SIMD_SSE2;
+#endif
+	return SIMD_SCALAR;
+}
+
+inline SimdLevel& currentSimdLevel()
+{
+	static SimdLevel level = supportedSimdLevel();
+	return level;
+}
+
+inline SimdLevel getSimdLevel()
+{
+	return currentSimdLevel();
+}
+
+/**
+ * Note: it is not thread safe, it should be called before running any algorithm.
+ */
+inline SimdLevel setSimdLevel(SimdLevel level)
+{
+	SimdLevel supported = supportedSimdLevel();
+	currentSimdLevel() = (level < supported) ? level : supported;
+	return currentSimdLevel();
+}
+
+inline OrientationKernel orientationKernel()
+{
+	switch (currentSimdLevel())
+	{
+#ifdef ORIENTATION_X86
+		case SIMD_AVX512: return orientationAVX512;
+		case SIMD_AVX2: return orientationAVX2;
+		case SIMD_SSE2: return orientationSSE2;
+#endif
+		default: return orientationScalar;
+	}
+}
+
+inline void orientationBatch(const Point2f& A, const Point2f& B, const float x[], const float y[], int n, signed char result[])
+{
+	orientationKernel()(A.x(), A.y(), (double) (B.x() - A.x()), (double) (B.y() - A.y()), x, y, n, result);
+}
+
+inline void orientationBatch(const Point2f& A, const Point2f& B, const Point2f C[], int n, signed char result[])
+{
+	//Points are split in columns by blocks, small enough to stay in L1 cache
+	const int BLOCK = 256;
+	alignas(64) float x[BLOCK];
+	alignas(64) float y[BLOCK];
+	
+	OrientationKernel kernel = orientationKernel();
+	for (int first = 0; first < n; first += BLOCK)
+	{
+		int size = (n - first < BLOCK) ? n - first : BLOCK;
+		for (int i = 0; i<size; i++)
+		{
+			x[i] = C[first+i].x();
+			y[i] = C[first+i].y();
+		}
+		kernel(A.x(), A.y(), (double) (B.x() - A.x()), (double) (B.y() - A.y()), x, y, size, result + first);
+	}
+}
+
+/**
+ * a + b = sum + error exactly, being sum the rounded addition (Knuth's two-sum)
+ */
+inline void twoSum(double a, double b, double &sum, double &error)
+{
+	sum = a + b;
+	double bVirtual = sum - a;
+	double aVirtual = sum - bVirtual;
+	error = (a - aVirtual) + (b - bVirtual);
+}
+
+/**
+ * a * b = product + error exactly, being product the rounded multiplication (the error by a fused multiply-add)
+ */
+inline void twoProduct(double a, double b, double &product, double &error)
+{
+	product = a * b;
+	error = std::fma(a, b, -product);
+}
+
+/**
+ * Sign of the exact sum of nTerms doubles (12 at most).
+ * Every term is added to the expansion (from the smallest component to the biggest one), and the
+ * errors of the additions are kept as new components, so the sum of the components is always exact
+ */
+inline int expansionSign(const double terms[], int nTerms)
+{
+	double expansion[12];
+	int size = 0;
+	for (int t = 0; t<nTerms; t++)
+	{
+		double q = terms[t];
+		int newSize = 0;
+		for (int i = 0; i<size; i++)
+		{
+			double error;
+			twoSum(q, expansion[i], q, error);
+			if (error != 0)		//(newSize <= i, so expansion[i] has already been read)
+				expansion[newSize++] = error;
+		}
+		if (q != 0)
+			expansion[newSize++] = q;
+		size = newSize;
+	}
+	
+	//The biggest component has got the sign of the whole sum
+	if (size == 0)
+		return 0;
+	return (expansion[size-1] > 0) - (expansion[size-1] < 0);
+}
+
+inline int turnExact(const Point2f& A,const Point2f& B,const Point2f& C)
+{
+	double ax = A.x(), ay = A.y(), bx = B.x(), by = B.y(), cx = C.x(), cy = C.y();
+	
+	//(B-A) x (C-A) = bx*cy - bx*ay - ax*cy - by*cx + by*ax + ay*cx (ax*ay is cancelled)
+	const double products[6] = {bx*cy, -(bx*ay), -(ax*cy), -(by*cx), by*ax, ay*cx};
+	return expansionSign(products, 6);
+}
+
+inline int turnExact(const Point2d& A,const Point2d& B,const Point2d& C)
+{
+	double ax = A.x(), ay = A.y(), bx = B.x(), by = B.y(), cx = C.x(), cy = C.y();
+	
+	const double factors[6][2] = {{bx, cy}, {-bx, ay}, {-ax, cy}, {-by, cx}, {by, ax}, {ay, cx}};
+	double products[12];
+	for (int t = 0; t<6; t++)
+		twoProduct(factors[t][0], factors[t][1], products[2*t], products[2*t+1]);
+	return expansionSign(products, 12);
+}
+
+#endif //orientation_h
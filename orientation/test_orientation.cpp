@@ -0,0 +1,218 @@
+/*
+ * test_orientation.cpp
+ *
+ * Descp: To test the orientation tests (orientation.h header)
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: some tests comparing orientationBatch with turn(), for every instruction set of the machine,
+ * 		and the exact tests (turnAdaptive, turnExact) with integer arithmetic, for every coordinate type.
+ * 
+ * Post: If the tests were ok or not.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include <iostream>
+#include <vector>
+#include <stdlib.h>     /* srand, rand */
+#include <cmath>        /* ldexp */
+#include <algorithm>    /* min, max */
+#include "../point/Point.h"
+#include "orientation.h"
+
+typedef bool (*ArrayOfTests[]) (); 
+using namespace std;
+
+const char* LEVEL_NAMES[] = {"scalar", "SSE2", "AVX2", "AVX-512"};
+
+/**
+ * Compares orientationBatch with turn() for all the points of C (and all the tails lengths),
+ * with every instruction set supported.
+ */
+bool sameAsTurn(const Point2f& A, const Point2f& B, const vector<Point2f> &C)
+{
+	int n = C.size();
+	vector<float> x(n), y(n);
+	vector<signed char> expected(n);
+	for (int i = 0; i<n; i++)
+	{
+		x[i] = C[i].x();
+		y[i] = C[i].y();
+		expected[i] = turn(A, B, C[i]);
+	}
+	
+	bool equal = true;
+	for (int level = SIMD_SCALAR; level <= supportedSimdLevel() && equal; level++)
+	{
+		setSimdLevel((SimdLevel) level);
+		for (int length = n - 17; length <= n && equal; length++)	//every possible tail
+		{
+			vector<signed char> byColumns(length + 1, 7), byPoints(length + 1, 7);
+			orientationBatch(A, B, x.data(), y.data(), length, byColumns.data());
+			orientationBatch(A, B, C.data(), length, byPoints.data());
+			for (int i = 0; i<length && equal; i++)
+				equal = byColumns[i] == expected[i] && byPoints[i] == expected[i];
+			equal = equal && byColumns[length] == 7 && byPoints[length] == 7;	//nothing written after the end
+		}
+		cout << "Same result than turn() with " << LEVEL_NAMES[level] << ": " << equal << endl;
+	}
+	setSimdLevel(SIMD_AVX512);
+	return equal;
+}
+
+bool testRandom()
+{
+	vector<Point2f> C(1000);
+	for (unsigned int i = 0; i<C.size(); i++)
+		C[i] = Point2f((rand() % 20001 - 10000) / 100.0f, (rand() % 20001 - 10000) / 100.0f);
+	return sameAsTurn(Point2f(-3.5f, 2), Point2f(7.25f, -1.5f), C);
+}
+
+/**
+ * Points on the line or very close to it, where the epsilon matters
+ */
+bool testNearlyCollinear()
+{
+	Point2f A(0.1f, 0.3f), B(10.7f, 5.6f);
+	vector<Point2f> C(1000);
+	for (unsigned int i = 0; i<C.size(); i++)
+	{
+		float t = (rand() % 10000) / 1000.0f;
+		float offset = (rand() % 3 - 1) * (rand() % 4) * 1e-6f;
+		C[i] = Point2f(A.x() + t * (B.x() - A.x()), A.y() + t * (B.y() - A.y()) + offset);
+	}
+	C[0] = A;
+	C[1] = B;
+	return sameAsTurn(A, B, C);
+}
+
+/**
+ * Vertical and horizontal lines, and A == B
+ */
+bool testDegenerateLines()
+{
+	vector<Point2f> C(100);
+	for (unsigned int i = 0; i<C.size(); i++)
+		C[i] = Point2f(rand() % 7 - 3, rand() % 7 - 3);
+	return sameAsTurn(Point2f(1,-2), Point2f(1,5), C)
+		&& sameAsTurn(Point2f(-2,1), Point2f(4,1), C)
+		&& sameAsTurn(Point2f(1,1), Point2f(1,1), C);
+}
+
+/**
+ * Exact orientation of 3 points with integer coordinates (lower than 2^24, so they are exact as floats)
+ * scaled by the same power of 2
+ */
+int integerTurn(long long ax, long long ay, long long bx, long long by, long long cx, long long cy)
+{
+	long long cross = (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+	return (cross > 0) - (cross < 0);
+}
+
+/**
+ * Almost collinear points with big and tiny coordinates, where turn() fails because of its epsilon
+ * and its float differences. turnAdaptive and turnExact have to give the exact orientation.
+ */
+bool testExact()
+{
+	const long long MAX_COORDINATE = 1 << 24;
+	const float SCALES[] = {1.0f, 1.0f / (1 << 20), 1.0f / (1 << 30) / (1 << 30), 1 << 20};
+	bool equal = true;
+	int turnErrors = 0;
+	atomic<long long> exactTests(0);
+	
+	for (int scale = 0; scale<4 && equal; scale++)
+		for (int i = 0; i<100000 && equal; i++)
+		{
+			long long ax = rand() % MAX_COORDINATE, ay = rand() % MAX_COORDINATE;
+			long long bx = rand() % MAX_COORDINATE, by = rand() % MAX_COORDINATE;
+			long long t = rand() % 1000;
+			long long cx = ax + (bx - ax) * t / 1000 + rand() % 3 - 1;
+			long long cy = ay + (by - ay) * t / 1000 + rand() % 3 - 1;
+			
+			float s = SCALES[scale];
+			Point2f A(ax * s, ay * s), B(bx * s, by * s), C(cx * s, cy * s);
+			int expected = integerTurn(ax, ay, bx, by, cx, cy);
+			equal = turnAdaptive(A, B, C, &exactTests) == expected && turnExact(A, B, C) == expected
+				&& turnAdaptive(B, A, C) == -expected && turnAdaptive(C, A, B) == expected;
+			turnErrors += turn(A, B, C) != expected;
+		}
+	
+	//The simplest cases: a straight line and a tiny triangle, which is a straight line for turn()
+	equal = equal && turnAdaptive(Point2f(0,0), Point2f(1,1), Point2f(3,3)) == 0
+		&& turnAdaptive(Point2f(0,0), Point2f(0.0001f,0), Point2f(0,0.0001f)) == 1
+		&& turn(Point2f(0,0), Point2f(0.0001f,0), Point2f(0,0.0001f)) == 0;
+	
+	cout << "Wrong results of turn(): " << turnErrors << ", calls to turnExact: " << exactTests.load() << endl;
+	return equal && exactTests.load() > 0;
+}
+
+/**
+ * Almost collinear points with int32_t coordinates up to its maxCoordinate, compared with the orientation
+ * computed in 128 bits. The same points, scaled and translated as int64_t and as double coordinates
+ * (exact), must have got the same orientation with turn (integers) and turnAdaptive (doubles).
+ */
+bool testCoordinateTypes()
+{
+	const int32_t MAX = CoordinateTraits<int32_t>::maxCoordinate;
+	const int64_t SHIFT = CoordinateTraits<int64_t>::maxCoordinate - ((int64_t) MAX << 31);
+	bool equal = true;
+	atomic<long long> exactTests(0);
+	
+	for (int i = 0; i<100000 && equal; i++)
+	{
+		int32_t ax = rand() % (2*MAX) - MAX, ay = rand() % (2*MAX) - MAX;
+		int32_t bx = rand() % (2*MAX) - MAX, by = rand() % (2*MAX) - MAX;
+		double t = (rand() % 1000) / 1000.0;
+		int32_t cx = (int32_t) (ax + (bx - (double) ax) * t) + rand() % 3 - 1;
+		int32_t cy = (int32_t) (ay + (by - (double) ay) * t) + rand() % 3 - 1;
+		cx = std::max(-MAX, std::min(MAX, cx));
+		cy = std::max(-MAX, std::min(MAX, cy));
+		
+		int128_t cross = (int128_t) ((int64_t) bx - ax) * ((int64_t) cy - ay) - (int128_t) ((int64_t) by - ay) * ((int64_t) cx - ax);
+		int expected = (cross > 0) - (cross < 0);
+		
+		Point2i A(ax, ay), B(bx, by), C(cx, cy);
+		Point2l AL(((int64_t) ax << 31) + SHIFT, ((int64_t) ay << 31) - SHIFT);
+		Point2l BL(((int64_t) bx << 31) + SHIFT, ((int64_t) by << 31) - SHIFT);
+		Point2l CL(((int64_t) cx << 31) + SHIFT, ((int64_t) cy << 31) - SHIFT);
+		Point2d AD(ldexp((double) ax, 100), ay), BD(ldexp((double) bx, 100), by), CD(ldexp((double) cx, 100), cy);
+		
+		equal = turn(A, B, C) == expected && turnAdaptive(A, B, C) == expected && turn(AL, BL, CL) == expected
+			&& turnAdaptive(AD, BD, CD, &exactTests) == -turnAdaptive(BD, AD, CD) && turnExact(AD, BD, CD) == expected
+			&& turnAdaptive(Point2d(ax, ay), Point2d(bx, by), Point2d(cx, cy), &exactTests) == expected;
+	}
+	
+	cout << "Same orientation for int32_t, int64_t and double points: " << equal
+		<< ", calls to turnExact for doubles: " << exactTests.load() << endl;
+	return equal && exactTests.load() > 0;
+}
+
+int main(int argc, char **argv)
+{
+	int failedTests = 0;
+	srand(2014);
+	cout << "Instruction set of this machine: " << LEVEL_NAMES[supportedSimdLevel()] << endl << endl;
+	
+	ArrayOfTests tests = {testRandom,testNearlyCollinear,testDegenerateLines,testExact,testCoordinateTypes};
+	const int NUM_TESTS = 5;
+	
+	for (int i = 0; i<NUM_TESTS; i++)
+	{
+		cout << "Starting test number " << i+1 << endl;
+		if (tests[i]())
+			cout << "The test " << i+1 << " was successfully passed!" << endl;
+		else
+		{
+			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
+		cout << "==================================================" << endl << endl;
+	}
+	
+	return failedTests > 0 ? 1 : 0;
+}
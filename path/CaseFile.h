@@ -0,0 +1,279 @@
+/*
+ * CaseFile.h
+ *
+ * Descp: Binary files of cases, laid out to be mapped into memory and used without parsing nor copying.
+ *
+ * Layout (in the byte order of the machine which wrote it, checked when the file is opened):
+ * 	CaseFileHeader
+ * 	numberOfCases testCase: init, dest, obstacleOffset and nPointsObstacle, as in a CaseSet
+ * 	numberOfPoints Point2f, from pointsOffset on (aligned to 64 bytes): the obstacles, one after another
+ * So once the file is mapped by MappedCaseFile, the case table and the points are the same arrays a CaseSet
+ * keeps in memory, and solveCase() reads the obstacles straight from the mapping.
+ *
+ * Opening a file only reads its header: the pages of a case are read from the disk by the operating system
+ * when the case is solved (no readahead is asked for the whole file), so the start doesn't depend on the
+ * size of the file.
+ * convertCaseFile() writes a binary file from a text one (see readFile, PathPlanning.h), case by case.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#ifndef CASE_FILE_H
+#define CASE_FILE_H
+
+#include "CaseSet.h"
+#include "CaseReader.h"
+#include <cstdio>		// fopen, fread, fwrite
+#include <cstring>		// memcmp, memcpy
+#include <vector>
+#include <iostream>		// std::cerr
+#include <climits>		// INT_MAX
+#include <stdint.h>		// uint32_t, uint64_t
+#include <type_traits>	// std::is_standard_layout
+
+#ifndef _WIN32
+#include <sys/mman.h>	// mmap
+#include <sys/stat.h>	// fstat
+#include <fcntl.h>		// open
+#include <unistd.h>		// close
+#endif
+
+static_assert(std::is_standard_layout<testCase>::value && sizeof(testCase) == 2*sizeof(Point2f) + 2*sizeof(int),
+	"testCase is mapped from the case files");
+
+struct CaseFileHeader
+{
+	char magic[8];					//CASE_FILE_MAGIC
+	uint32_t byteOrder;				//CASE_FILE_BYTE_ORDER, as written by the machine
+	uint32_t version;
+	uint32_t numberOfCases;
+	uint32_t maxPointsObstacle;		//points of the biggest obstacle, to reserve the PathScratch at once
+	uint64_t numberOfPoints;
+	uint64_t pointsOffset;			//from the beginning of the file
+};
+
+static const char CASE_FILE_MAGIC[8] = {'C', 'H', 'C', 'A', 'S', 'E', 'S', '\0'};
+static const uint32_t CASE_FILE_BYTE_ORDER = 0x01020304;
+static const uint32_t CASE_FILE_VERSION = 1;
+static const uint64_t CASE_FILE_ALIGNMENT = 64;
+
+/**
+ * Whether the file is a binary file of cases (only its magic number is checked)
+ */
+inline bool isCaseFile(const char *filePath)
+{
+	char magic[sizeof(CASE_FILE_MAGIC)];
+	std::FILE *file = std::fopen(filePath, "rb");
+	if (file == NULL)
+		return false;
+	bool isBinary = std::fread(magic, 1, sizeof(magic), file) == sizeof(magic)
+		&& std::memcmp(magic, CASE_FILE_MAGIC, sizeof(magic)) == 0;
+	std::fclose(file);
+	return isBinary;
+}
+
+/**
+ * Writes the binary file of the cases of a text file. The cases are read and written one by one, so only the
+ * table of cases is kept in memory.
+ * Returns the number of cases written, or -1 if a file couldn't be read or written or a case is not valid.
+ */
+inline int convertCaseFile(const char *textPath, const char *binaryPath)
+{
+	CaseReader reader(textPath);
+	if (!reader.isOpen())
+	{
+		std::cerr << "Input file couldn't be read" << std::endl;
+		return -1;
+	}
+	if (!reader.readHeader())
+	{
+		std::cerr << reader.error() << std::endl;
+		return -1;
+	}
+
+	std::FILE *out = std::fopen(binaryPath, "wb");
+	if (out == NULL)
+	{
+		std::cerr << "Output file couldn't be written" << std::endl;
+		return -1;
+	}
+
+	CaseFileHeader header;
+	std::memcpy(header.magic, CASE_FILE_MAGIC, sizeof(header.magic));
+	header.byteOrder = CASE_FILE_BYTE_ORDER;
+	header.version = CASE_FILE_VERSION;
+	header.numberOfCases = reader.numberOfCases();
+	header.maxPointsObstacle = 0;
+	header.numberOfPoints = 0;
+	uint64_t tableEnd = sizeof(CaseFileHeader) + (uint64_t) reader.numberOfCases() * sizeof(testCase);
+	header.pointsOffset = (tableEnd + CASE_FILE_ALIGNMENT-1) / CASE_FILE_ALIGNMENT * CASE_FILE_ALIGNMENT;
+
+	//The points are written while they are read, after the room of the header and the table
+	std::vector<testCase> table;
+	table.reserve(reader.numberOfCases());
+	CaseSet current;
+	bool ok = std::fseek(out, (long) header.pointsOffset, SEEK_SET) == 0;
+	for (int counter = 0; ok && counter < reader.numberOfCases(); ++counter)
+	{
+		current.clear();
+		if (!reader.readCase(current))
+		{
+			std::cerr << "Case " << counter << ": " << reader.error() << " (line " << reader.line() << ")" << std::endl;
+			std::fclose(out);
+			std::remove(binaryPath);
+			return -1;
+		}
+
+		testCase c = current.cases[0];
+		if (header.numberOfPoints + c.nPointsObstacle > (uint64_t) INT_MAX)
+		{
+			std::cerr << "Case " << counter << ": too many points for a case file" << std::endl;
+			std::fclose(out);
+			std::remove(binaryPath);
+			return -1;
+		}
+		c.obstacleOffset = (int) header.numberOfPoints;
+		table.push_back(c);
+		ok = std::fwrite(current.points.data(), sizeof(Point2f), c.nPointsObstacle, out) == (size_t) c.nPointsObstacle;
+		header.numberOfPoints += c.nPointsObstacle;
+		header.maxPointsObstacle = std::max(header.maxPointsObstacle, (uint32_t) c.nPointsObstacle);
+	}
+
+	//The header and the table, once they are known
+	ok = ok && std::fseek(out, 0, SEEK_SET) == 0
+		&& std::fwrite(&header, sizeof(header), 1, out) == 1
+		&& std::fwrite(table.data(), sizeof(testCase), table.size(), out) == table.size();
+	ok = std::fclose(out) == 0 && ok;
+	if (!ok)
+	{
+		std::cerr << "Output file couldn't be written" << std::endl;
+		std::remove(binaryPath);
+		return -1;
+	}
+	return reader.numberOfCases();
+}
+
+/**
+ * A binary file of cases, mapped into memory (read into memory where mmap is not available).
+ * The cases and their obstacles are used in place, like the ones of a CaseSet.
+ */
+class MappedCaseFile
+{
+	public:
+		MappedCaseFile() : m_data(NULL), m_size(0), m_header(NULL), m_error(NULL) {}
+		~MappedCaseFile() { close(); }
+
+		/**
+		 * Maps the file and checks its header, without reading the cases.
+		 * Returns false if it is not a valid case file (see error()).
+		 */
+		bool open(const char *filePath)
+		{
+			close();
+#ifndef _WIN32
+			int fd = ::open(filePath, O_RDONLY);
+			if (fd < 0)
+				return fail("Input file couldn't be read");
+			struct stat status;
+			if (fstat(fd, &status) != 0 || status.st_size < (off_t) sizeof(CaseFileHeader))
+			{
+				::close(fd);
+				return fail("Not a case file");
+			}
+			void *data = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			::close(fd);
+			if (data == MAP_FAILED)
+				return fail("Input file couldn't be mapped");
+			m_data = static_cast<const char*>(data);
+			m_size = status.st_size;
+#else
+			std::FILE *file = std::fopen(filePath, "rb");
+			if (file == NULL)
+				return fail("Input file couldn't be read");
+			char chunk[1 << 16];
+			size_t read;
+			while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0)
+				m_copy.insert(m_copy.end(), chunk, chunk + read);
+			std::fclose(file);
+			m_data = m_copy.data();
+			m_size = m_copy.size();
+#endif
+
+			const CaseFileHeader *header = reinterpret_cast<const CaseFileHeader*>(m_data);
+			if (m_size < sizeof(CaseFileHeader) || std::memcmp(header->magic, CASE_FILE_MAGIC, sizeof(header->magic)) != 0)
+				return fail("Not a case file");
+			uint64_t tableEnd = sizeof(CaseFileHeader) + (uint64_t) header->numberOfCases * sizeof(testCase);
+			if (header->byteOrder != CASE_FILE_BYTE_ORDER || header->version != CASE_FILE_VERSION)
+				return fail("Case file of another version or byte order");
+			//Sizes are compared with the room left in the file, so a corrupted header can't wrap them around
+			if (header->numberOfCases > (uint32_t) INT_MAX || header->numberOfPoints > (uint64_t) INT_MAX
+				|| header->pointsOffset < tableEnd || header->pointsOffset % CASE_FILE_ALIGNMENT != 0
+				|| header->pointsOffset > m_size
+				|| header->numberOfPoints > (m_size - header->pointsOffset) / sizeof(Point2f))
+				return fail("Case file is truncated or corrupted");
+			//The PathScratch is reserved for the biggest obstacle (4 points per point of it, see PathScratch)
+			if (header->maxPointsObstacle > header->numberOfPoints || header->maxPointsObstacle > (uint32_t) (INT_MAX / 4))
+				return fail("Case file is truncated or corrupted");
+			m_header = header;
+			return true;
+		}
+
+		void close()
+		{
+#ifndef _WIN32
+			if (m_data != NULL)
+				munmap(const_cast<char*>(m_data), m_size);
+#else
+			std::vector<char>().swap(m_copy);
+#endif
+			m_data = NULL;
+			m_size = 0;
+			m_header = NULL;
+		}
+
+		bool isOpen() const { return m_header != NULL; }
+		const char* error() const { return m_error; }
+		int size() const { return m_header->numberOfCases; }
+		int maxPointsObstacle() const { return m_header->maxPointsObstacle; }
+
+		const testCase& getCase(int i) const
+		{
+			return reinterpret_cast<const testCase*>(m_data + sizeof(CaseFileHeader))[i];
+		}
+
+		const Point2f* obstacle(const testCase &c) const
+		{
+			return reinterpret_cast<const Point2f*>(m_data + m_header->pointsOffset) + c.obstacleOffset;
+		}
+
+		//The obstacle of the case is inside the file (the table is not checked when the file is opened)
+		bool isValid(const testCase &c) const
+		{
+			return c.obstacleOffset >= 0 && c.nPointsObstacle >= 0 && c.nPointsObstacle <= maxPointsObstacle()
+				&& (uint64_t) c.obstacleOffset <= m_header->numberOfPoints
+				&& (uint64_t) c.nPointsObstacle <= m_header->numberOfPoints - c.obstacleOffset;
+		}
+
+	private:
+		const char *m_data;
+		size_t m_size;
+		const CaseFileHeader *m_header;	//null if no valid file is open
+		const char *m_error;
+#ifdef _WIN32
+		std::vector<char> m_copy;
+#endif
+
+		MappedCaseFile(const MappedCaseFile&);
+		MappedCaseFile& operator=(const MappedCaseFile&);
+
+		bool fail(const char *error)
+		{
+			close();
+			m_error = error;
+			return false;
+		}
+};
+
+#endif // CASE_FILE_H
@@ -0,0 +1,78 @@
+/*
+ * CaseSet.h
+ *
+ * Descp: Cases of the robot path planning problem (see PathPlanning.h): departure, destination and the
+ * points of the obstacle.
+ *
+ * The points of all the obstacles are stored one after another in the same array (an arena), and every case
+ * has got the offset and the number of its points, so there is no limit for the size of an obstacle and no
+ * allocation per case. Once a CaseSet has held its biggest case, clearing it and adding cases again reuses
+ * the same memory.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#ifndef CASE_SET_H
+#define CASE_SET_H
+
+#include "../point/Point.h"
+#include <vector>
+#include <algorithm>	// std::max
+
+/**
+ * A case: departure, destination and the obstacle, whose nPointsObstacle points are stored in
+ * CaseSet::points from obstacleOffset on.
+ */
+struct testCase
+{
+	Point2f init, dest;
+	int obstacleOffset;
+	int nPointsObstacle;
+};
+
+struct CaseSet
+{
+	std::vector<testCase> cases;
+	std::vector<Point2f> points;
+	int maxPointsObstacle;		//points of the biggest obstacle
+
+	CaseSet() : maxPointsObstacle(0) {}
+
+	int size() const { return cases.size(); }
+	const testCase& getCase(int i) const { return cases[i]; }
+	const Point2f* obstacle(const testCase &c) const { return points.data() + c.obstacleOffset; }
+
+	void clear()
+	{
+		cases.clear();
+		points.clear();
+		maxPointsObstacle = 0;
+	}
+
+	//Appends a case without obstacle; its points are appended by addObstaclePoint
+	void addCase(const Point2f &init, const Point2f &dest)
+	{
+		testCase c = {init, dest, (int) points.size(), 0};
+		cases.push_back(c);
+	}
+
+	//Appends a point to the obstacle of the last case
+	void addObstaclePoint(const Point2f &p)
+	{
+		points.push_back(p);
+		maxPointsObstacle = std::max(maxPointsObstacle, ++cases.back().nPointsObstacle);
+	}
+
+	//Appends a case whose obstacle is given by the n points of obstacle
+	void add(const Point2f &init, const Point2f &dest, const Point2f obstacle[], int n)
+	{
+		testCase c = {init, dest, (int) points.size(), n};
+		cases.push_back(c);
+		points.insert(points.end(), obstacle, obstacle + n);
+		maxPointsObstacle = std::max(maxPointsObstacle, n);
+	}
+};
+
+#endif // CASE_SET_H
@@ -0,0 +1,580 @@
+/*
+ * PathPlanning.h
+ *
+ * Descp: The robot path planning problem: the shortest path between two points, A and B, avoiding an
+ * obstacle located in the middle of them.
+ *
+ * The shortest path is one of the two halves of the convex hull of A U B U obstacle (the mid hulls): the
+ * one going from A to B clockwise or the one going counterclockwise, whichever is shorter.
+ *
+ * solveCase() does no I/O: it only fills a CaseSummary (and a CaseTrace, if asked for). The verbose output
+ * of main, printCaseTrace(), is printed after the computation, and only if PathOptions::quiet is false;
+ * otherwise the only output is one summary line per case (printCaseSummary).
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: <Departure (A)
+ * 		<Destination (B)
+ * 		<array of points which are the vertices of the the obstacle
+ *
+ * Post:
+ * 		>Convex hull of A U B U Obstacle
+ * 		>Shortest path joining A and B, dodging the obstacle
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#ifndef PATH_PLANNING_H
+#define PATH_PLANNING_H
+
+#include "../CH_Algorithms.h"
+#include "CaseSet.h"
+#include "CaseReader.h"
+#include "CaseFile.h"
+#include <vector>
+#include <string>       // std::string
+#include <iostream>     // std::cout
+#include <algorithm>	// std::max
+
+/**
+ * Memory to solve the cases, in one buffer: the set of points of the case (A U obstacle U B), which is sorted
+ * by the hull algorithms, the iterative hull (n+1 points) and the buffer of the divide and conquer (2n points).
+ * It only grows, so once it is reserved for the biggest case, solving cases allocates nothing.
+ */
+struct PathScratch
+{
+	std::vector<Point2f> buffer;
+
+	void reserve(int nPoints)
+	{
+		size_t size = 4 * (size_t) nPoints + 1;	//in size_t, it doesn't overflow for any number of points
+		if (buffer.size() < size)
+			buffer.resize(size);
+	}
+
+	Point2f* points() { return buffer.data(); }
+	Point2f* hull(int nPoints) { return buffer.data() + nPoints; }
+	Point2f* dcBuffer(int nPoints) { return buffer.data() + 2*nPoints + 1; }
+};
+
+//When the divide and conquer algorithm is run too, to check the path of the iterative one
+enum CrossCheck { CHECK_OFF, CHECK_SAMPLED, CHECK_ALWAYS };
+
+//Cases solved in parallel are read and solved by batches of this number of cases or points at most...
+const int PATH_BATCH_CASES = 4096;
+const int PATH_BATCH_POINTS = 1 << 20;
+//...which are split into tasks of this number of cases or points at most
+const int PATH_TASK_CASES = 64;
+const int PATH_TASK_POINTS = 8192;
+
+/**
+ * Settings of the path planning
+ */
+struct PathOptions
+{
+	bool quiet;				//production mode: no output while reading and solving the cases, just one summary per case
+	int threads;			//threads to solve the cases in quiet mode (1 = one after another)
+	CrossCheck check;
+	int checkEvery;			//CHECK_SAMPLED: one case of every checkEvery is checked (by its index, so the same ones always)
+
+	PathOptions() : quiet(false), threads(1), check(CHECK_ALWAYS), checkEvery(64) {}
+
+	bool isChecked(int caseIndex) const
+	{
+		return check == CHECK_ALWAYS || (check == CHECK_SAMPLED && caseIndex % std::max(checkEvery, 1) == 0);
+	}
+};
+
+/**
+ * Result of one case
+ */
+struct CaseSummary
+{
+	int caseIndex;
+	int nPoints;			//points of the case: A, B and the obstacle
+	int hullSize;			//vertices of the convex hull
+	int pathSize;			//vertices of the shortest path, A and B included
+	bool isUpperShortest;	//the shortest path is the upper mid hull (clockwise from A)
+	float length;			//length of the shortest path
+	bool isChecked;			//the divide and conquer algorithm was run too
+	bool sameResults;		//the iterative and the divide and conquer algorithms gave the same path (if not checked, the path was found)
+};
+
+/**
+ * Intermediate results of one case, for the verbose output
+ */
+struct MidHulls
+{
+	std::vector<Point2f> upper, lower;
+	float upperLength, lowerLength;
+
+	const std::vector<Point2f>& shortest() const { return upperLength <= lowerLength ? upper : lower; }
+};
+
+struct CaseTrace
+{
+	std::vector<Point2f> points;
+	MidHulls iterative, divideAndConquer;
+};
+
+/**
+ * Syntax of the input file is the following:
+ * NUMCASES N -> N: integer which represent number of cases
+ * case i begin -> i: declarates that case i is starting to be defined
+ * initx inity -> two floats: initx and inity, which defines the initial point
+ * destx desty -> two floats: destx and desty, which defines the destination point
+ * n -> n: integer which defines the number of points for defining the obstacle
+ * subsequently, there are n pairs of x and y coordinates for each point defining the obstacle.
+ * end -> defines the end for case i
+ */
+inline bool readFile(const char* filePath, CaseSet &cases, const PathOptions &options = PathOptions())
+{
+	CaseReader reader(filePath);
+	cases.clear();
+
+	if (!reader.isOpen())
+	{
+		std::cerr << "Input file couldn't be read" << std::endl;
+		return false;
+	}
+	if (!reader.readHeader())
+	{
+		std::cerr << reader.error() << std::endl;
+		return false;
+	}
+
+	cases.cases.reserve(reader.numberOfCases());
+	if (!options.quiet)
+		std::cout << "Number of cases defined: " << reader.numberOfCases() << std::endl;
+
+	for (int counter = 0; counter < reader.numberOfCases(); ++counter)
+	{
+		if (!options.quiet)
+			std::cout << "Reading case " << counter << std::endl;
+		if (!reader.readCase(cases))
+		{
+			std::cerr << "Case " << counter << ": " << reader.error() << " (line " << reader.line() << ")" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Both convex hull mids, from the initial point (the first one of the hull) to the destination point,
+ * without copying them: the upper one is hull[0], hull[1], ..., hull[destIndex] and the lower one
+ * hull[0], hull[hullSize-1], ..., hull[destIndex].
+ */
+struct MidHullLengths
+{
+	int destIndex;
+	float upperLength, lowerLength;
+
+	bool isUpperShortest() const { return upperLength <= lowerLength; }
+	//Number of points of the shortest mid hull, and its k-th point
+	int shortestSize(int hullSize) const { return isUpperShortest() ? destIndex+1 : hullSize-destIndex+1; }
+	int shortestIndex(int hullSize, int k) const { return isUpperShortest() ? k : (hullSize-k) % hullSize; }
+};
+
+/**
+ * Note: initialPoint != destinationPoint, so at least, hullSize > 1
+ * Returns false if destinationPoint is not in the hull.
+ */
+inline bool measureMidHulls(const Point2f hull[], int hullSize, const Point2f &destinationPoint, MidHullLengths &mids)
+{
+	mids.destIndex = 0;
+	while (mids.destIndex < hullSize && !(hull[mids.destIndex] == destinationPoint))
+		mids.destIndex++;
+	if (mids.destIndex == hullSize)
+		return false;
+
+	//Lengths are added in the order of the paths
+	mids.upperLength = 0;
+	for (int j = 0; j < mids.destIndex; j++)
+		mids.upperLength += hull[j].distanceBetweenTwoPoints(hull[j+1]);
+	mids.lowerLength = 0;
+	for (int k = 0; k != mids.destIndex; k = (k+hullSize-1) % hullSize)
+		mids.lowerLength += hull[k].distanceBetweenTwoPoints(hull[(k+hullSize-1) % hullSize]);
+	return true;
+}
+
+/**
+ * Copies of both mids, for the verbose output
+ */
+inline void calculateMidHulls(const Point2f hull[], int hullSize, const MidHullLengths &lengths, MidHulls &mids)
+{
+	mids.upper.assign(hull, hull + lengths.destIndex+1);
+	mids.lower.clear();
+	for (int k = 0; k != lengths.destIndex; k = (k+hullSize-1) % hullSize)
+		mids.lower.push_back(hull[k]);
+	mids.lower.push_back(hull[lengths.destIndex]);
+	mids.upperLength = lengths.upperLength;
+	mids.lowerLength = lengths.lowerLength;
+}
+
+/**
+ * Solves case c, whose obstacle is given by obstacle[0..c.nPointsObstacle), by the iterative algorithm and,
+ * if check is true, by the divide and conquer one too, to compare their paths.
+ * The obstacle is only read, so it can be the one of a MappedCaseFile.
+ * Nothing is allocated if scratch is already reserved for the case (and trace is null).
+ * If trace is not null, the intermediate results are copied there.
+ */
+inline void solveCase(const testCase &c, const Point2f obstacle[], int caseIndex, PathScratch &scratch,
+	CaseSummary &summary, CaseTrace *trace = NULL, bool check = true)
+{
+	int n = c.nPointsObstacle;
+	scratch.reserve(n+2);
+	Point2f *pointsToGetHull = scratch.points();
+
+	//Construct set union(obstacle, initialPoint, destinationPoint)
+	pointsToGetHull[0] = c.init;
+	for (int i = 0, j = 1; i<n; ++i, ++j)
+		pointsToGetHull[j] = obstacle[i];
+	pointsToGetHull[n+1] = c.dest;
+	if (trace != NULL)
+		trace->points.assign(pointsToGetHull, pointsToGetHull + n+2);
+
+	Point2f *hull = scratch.hull(n+2), *dcHull = scratch.dcBuffer(n+2);
+	int hullSize = IterativeConvexHull (pointsToGetHull, n+2, hull);
+	int dcHullSize = check ? DivideAndConquestConvexHull (pointsToGetHull, n+2, dcHull, HullOptions()) : 0;
+
+	MidHullLengths mids, dcMids;
+	bool found = hull[0] == c.init && measureMidHulls(hull, hullSize, c.dest, mids);
+	bool dcFound = check && dcHull[0] == c.init && measureMidHulls(dcHull, dcHullSize, c.dest, dcMids);
+
+	summary.caseIndex = caseIndex;
+	summary.nPoints = n+2;
+	summary.hullSize = hullSize;
+	summary.isUpperShortest = found && mids.isUpperShortest();
+	summary.pathSize = found ? mids.shortestSize(hullSize) : 0;
+	summary.length = !found ? 0 : summary.isUpperShortest ? mids.upperLength : mids.lowerLength;
+
+	//Both shortest paths have to be the same
+	summary.isChecked = check;
+	summary.sameResults = !check ? found : found && dcFound && summary.isUpperShortest == dcMids.isUpperShortest()
+		&& summary.pathSize == dcMids.shortestSize(dcHullSize);
+	for (int k = 0; check && summary.sameResults && k < summary.pathSize; k++)
+		summary.sameResults = hull[mids.shortestIndex(hullSize, k)] == dcHull[dcMids.shortestIndex(dcHullSize, k)];
+
+	if (trace != NULL)
+	{
+		trace->iterative = MidHulls();
+		trace->divideAndConquer = MidHulls();
+		if (found)
+			calculateMidHulls(hull, hullSize, mids, trace->iterative);
+		if (dcFound)
+			calculateMidHulls(dcHull, dcHullSize, dcMids, trace->divideAndConquer);
+	}
+}
+
+/**
+ * Solves case caseIndex of cases
+ */
+inline void solveCase(const CaseSet &cases, int caseIndex, PathScratch &scratch, CaseSummary &summary,
+	CaseTrace *trace = NULL, bool check = true)
+{
+	const testCase &c = cases.cases[caseIndex];
+	solveCase(c, cases.obstacle(c), caseIndex, scratch, summary, trace, check);
+}
+
+/**
+ * Cases [firstCase, firstCase+nCases) of a file, stored in cases (from the first one on) or in the file itself
+ */
+struct CaseBatch
+{
+	int firstCase, nCases;
+	int first;							//index of case firstCase in the CaseSet or MappedCaseFile
+	bool isError;						//the batch ends before a case which is not valid
+	CaseSet cases;						//text files: the cases of the batch
+	std::vector<CaseSummary> summaries;
+	WorkStealingPool::TaskGroup solving;
+
+	CaseBatch() : firstCase(0), nCases(0), first(0), isError(false) {}
+};
+
+/**
+ * Spawns the tasks to solve the cases of batch, which are in cases (a CaseSet or a MappedCaseFile). Every task
+ * solves a few consecutive cases with the scratch of the thread which runs it.
+ */
+template<class Cases>
+void spawnBatch(WorkStealingPool &pool, const Cases &cases, CaseBatch &batch, std::vector<PathScratch> &scratches,
+	const PathOptions &options)
+{
+	batch.summaries.resize(batch.nCases);
+	for (int begin = 0, end; begin < batch.nCases; begin = end)
+	{
+		int points = 0;
+		for (end = begin; end < batch.nCases && end - begin < PATH_TASK_CASES && points < PATH_TASK_POINTS; end++)
+			points += cases.getCase(batch.first + end).nPointsObstacle;
+
+		CaseSummary *summaries = batch.summaries.data();
+		int first = batch.first, firstCase = batch.firstCase;
+		pool.spawn(batch.solving, [&pool, &cases, &scratches, &options, summaries, first, firstCase, begin, end]()
+		{
+			PathScratch &scratch = scratches[pool.threadIndex()];
+			for (int i = begin; i < end; i++)
+			{
+				const testCase &c = cases.getCase(first + i);
+				solveCase(c, cases.obstacle(c), firstCase + i, scratch, summaries[i], NULL, options.isChecked(firstCase + i));
+			}
+		});
+	}
+}
+
+/**
+ * Solves the cases in parallel, by batches: while the threads of the pool solve a batch, the calling thread
+ * reads the next one (read(batch) fills it and returns the CaseSet or MappedCaseFile where its cases are;
+ * an empty batch is the end). Then it helps to solve the batch, and gives its summaries to done in order,
+ * so the output is the same for any number of threads.
+ * Returns the number of cases solved, or -1 if a case is not valid.
+ */
+template<class Cases, class Read, class Done>
+int solveBatches(const PathOptions &options, Read read, Done done)
+{
+	WorkStealingPool pool(options.threads);
+	std::vector<PathScratch> scratches(pool.size());
+	CaseBatch batches[2];
+	CaseBatch *batch = &batches[0], *next = &batches[1];
+	int solved = 0;
+
+	const Cases *cases = read(*batch);
+	while (batch->nCases > 0)
+	{
+		spawnBatch(pool, *cases, *batch, scratches, options);
+		const Cases *nextCases = batch->isError ? NULL : read(*next);
+		pool.wait(batch->solving);
+
+		for (int i = 0; i < batch->nCases; i++)
+			done(batch->summaries[i], (const CaseTrace*) NULL);
+		solved += batch->nCases;
+		if (batch->isError)
+			return -1;
+		std::swap(batch, next);
+		cases = nextCases;
+	}
+	return batch->isError ? -1 : solved;
+}
+
+/**
+ * Same as solveFile, for a binary file of cases (see CaseFile.h): the obstacles are read from the mapping,
+ * and nothing is copied but into the scratch.
+ */
+template<class Done>
+int solveCaseFile(const char* filePath, const PathOptions &options, Done done)
+{
+	MappedCaseFile file;
+	if (!file.open(filePath))
+	{
+		std::cerr << file.error() << std::endl;
+		return -1;
+	}
+	if (!options.quiet)
+		std::cout << "Number of cases defined: " << file.size() << std::endl
+			<< "==================================================" << std::endl << std::endl;
+
+	if (options.quiet && options.threads > 1)
+	{
+		int nextCase = 0;
+		return solveBatches<MappedCaseFile>(options, [&file, &nextCase](CaseBatch &batch) -> const MappedCaseFile*
+		{
+			batch.first = batch.firstCase = nextCase;
+			batch.isError = false;
+			int points = 0;
+			for (; nextCase < file.size() && nextCase - batch.firstCase < PATH_BATCH_CASES && points < PATH_BATCH_POINTS;
+				nextCase++)
+			{
+				const testCase &c = file.getCase(nextCase);
+				if (!file.isValid(c))
+				{
+					std::cerr << "Case " << nextCase << ": obstacle out of the file" << std::endl;
+					batch.isError = true;
+					break;
+				}
+				points += c.nPointsObstacle;
+			}
+			batch.nCases = nextCase - batch.firstCase;
+			return &file;
+		}, done);
+	}
+
+	PathScratch scratch;
+	scratch.reserve(file.maxPointsObstacle() + 2);
+	CaseTrace trace;
+	for (int counter = 0; counter < file.size(); ++counter)
+	{
+		const testCase &c = file.getCase(counter);
+		if (!file.isValid(c))
+		{
+			std::cerr << "Case " << counter << ": obstacle out of the file" << std::endl;
+			return -1;
+		}
+
+		CaseSummary summary;
+		solveCase(c, file.obstacle(c), counter, scratch, summary, options.quiet ? NULL : &trace, options.isChecked(counter));
+		done(summary, options.quiet ? NULL : &trace);
+	}
+	return file.size();
+}
+
+/**
+ * Solves the cases of a file while it is read: in quiet mode, every case is solved as soon as it is parsed,
+ * so the memory used depends on the biggest case, not on the size of the file. The verbose mode reads all
+ * the cases first, printing "Reading case i" for each one, as readFile. Binary files of cases are solved by
+ * solveCaseFile. In quiet mode, with options.threads > 1, the cases are solved in parallel by batches (see
+ * solveBatches).
+ * done(summary, trace) is called for every case, in the order of the file; trace is null in quiet mode.
+ * Returns the number of cases solved, or -1 if the file couldn't be read or a case is not valid.
+ */
+template<class Done>
+int solveFile(const char* filePath, const PathOptions &options, Done done)
+{
+	if (isCaseFile(filePath))
+		return solveCaseFile(filePath, options, done);
+
+	CaseReader reader(filePath);
+	if (!reader.isOpen())
+	{
+		std::cerr << "Input file couldn't be read" << std::endl;
+		return -1;
+	}
+	if (!reader.readHeader())
+	{
+		std::cerr << reader.error() << std::endl;
+		return -1;
+	}
+	if (!options.quiet)
+		std::cout << "Number of cases defined: " << reader.numberOfCases() << std::endl;
+
+	if (options.quiet && options.threads > 1)
+		return solveBatches<CaseSet>(options, [&reader](CaseBatch &batch) -> const CaseSet*
+		{
+			batch.cases.clear();
+			batch.first = 0;
+			batch.firstCase = reader.casesRead();
+			batch.isError = false;
+			while (reader.casesRead() < reader.numberOfCases() && batch.cases.size() < PATH_BATCH_CASES
+				&& (int) batch.cases.points.size() < PATH_BATCH_POINTS)
+				if (!reader.readCase(batch.cases))
+				{
+					std::cerr << "Case " << reader.casesRead() << ": " << reader.error() << " (line " << reader.line()
+						<< ")" << std::endl;
+					batch.isError = true;
+					break;
+				}
+			batch.nCases = batch.cases.size();
+			return &batch.cases;
+		}, done);
+
+	PathScratch scratch;
+	if (!options.quiet)
+	{
+		//The verbose output shows every case being read before any is solved (its trace is as long as the file anyway)
+		CaseSet cases;
+		for (int counter = 0; counter < reader.numberOfCases(); ++counter)
+		{
+			std::cout << "Reading case " << counter << std::endl;
+			if (!reader.readCase(cases))
+			{
+				std::cerr << "Case " << counter << ": " << reader.error() << " (line " << reader.line() << ")" << std::endl;
+				return -1;
+			}
+		}
+		std::cout << "==================================================" << std::endl << std::endl;
+
+		CaseTrace trace;
+		for (int counter = 0; counter < cases.size(); ++counter)
+		{
+			CaseSummary summary;
+			solveCase(cases, counter, scratch, summary, &trace, options.isChecked(counter));
+			done(summary, &trace);
+		}
+		return cases.size();
+	}
+
+	CaseSet current;	//the case being solved
+	for (int counter = 0; counter < reader.numberOfCases(); ++counter)
+	{
+		current.clear();
+		if (!reader.readCase(current))
+		{
+			std::cerr << "Case " << counter << ": " << reader.error() << " (line " << reader.line() << ")" << std::endl;
+			return -1;
+		}
+
+		CaseSummary summary;
+		solveCase(current, 0, scratch, summary, NULL, options.isChecked(counter));
+		summary.caseIndex = counter;
+		done(summary, NULL);
+	}
+	return reader.numberOfCases();
+}
+
+/**
+ * Print the points stored in vector<Point2f>
+ */
+inline void printVector(const std::vector<Point2f> &s, std::ostream &out = std::cout)
+{
+	for (unsigned int i = 0; i < s.size(); ++i)
+		out << "p" << i << '(' << s[i].x() << ',' << s[i].y() << "), ";	//(x,y) for each point
+	out << std::endl;
+}
+
+inline void printMidHulls(const MidHulls &mids, std::ostream &out)
+{
+	out << "Upper mid convex hull is: ";
+	printVector(mids.upper, out);
+	out << "Lower mid convex hull is: ";
+	printVector(mids.lower, out);
+	if (mids.upperLength <= mids.lowerLength)
+		out << "The upper mid hull is the shortest path, with length: " << mids.upperLength << std::endl;
+	else
+		out << "The lower mid hull is the shortest path, with length: " << mids.lowerLength << std::endl;
+}
+
+/**
+ * Verbose output of one case
+ */
+inline void printCaseTrace(const CaseSummary &summary, const CaseTrace &trace, std::ostream &out = std::cout)
+{
+	out << "----->Running case " << summary.caseIndex << "<-----" << std::endl;
+	out << "Points to be explored:";
+	for (unsigned int i = 0; i<trace.points.size(); i++)
+		out << " ("<< trace.points[i].x() << "," << trace.points[i].y() << ")";
+	out << std::endl;
+
+	out << "Calculating convex hull set by iterative algorithm..." << std::endl;
+	printMidHulls(trace.iterative, out);
+	out << "This is the final shortest path avoiding the obstacle found by iterative: ";
+	printVector(trace.iterative.shortest(), out);
+	out << std::endl;
+	out << "---------------------------------------------------" << std::endl << std::endl;
+
+	if (!summary.isChecked)
+	{
+		out << "==================================================" << std::endl << std::endl;
+		return;
+	}
+	out << "Calculating convex hull set by divide and conquest algorithm..." << std::endl;
+	printMidHulls(trace.divideAndConquer, out);
+	out << "This is the final shortest path avoiding the obstacle found by divide & conquest algorithm: ";
+	printVector(trace.divideAndConquer.shortest(), out);
+	out << "==================================================" << std::endl << std::endl;
+}
+
+/**
+ * One line per case, as key=value fields:
+ * case=0 points=7 hull=5 path=upper pathPoints=3 length=4.74765 check=ok
+ * check is off for the cases not checked by the divide and conquer algorithm (see PathOptions::check).
+ */
+inline void printCaseSummary(const CaseSummary &summary, std::ostream &out = std::cout)
+{
+	out << "case=" << summary.caseIndex << " points=" << summary.nPoints << " hull=" << summary.hullSize
+		<< " path=" << (summary.isUpperShortest ? "upper" : "lower") << " pathPoints=" << summary.pathSize
+		<< " length=" << summary.length << " check=" << (!summary.isChecked ? "off" : summary.sameResults ? "ok" : "failed")
+		<< '\n';
+}
+
+#endif // PATH_PLANNING_H
@@ -0,0 +1,32 @@
+/*
+ * convert_cases.cpp
+ *
+ * Descp: Converts a text file of cases (see readFile, PathPlanning.h) into a binary one (see CaseFile.h),
+ * which main maps into memory instead of parsing it.
+ *
+ * Usage: convert_cases input.in output.bin
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include "CaseFile.h"
+#include <iostream>     // std::cout
+
+using namespace std;
+
+int main(int argc, char **argv)
+{
+	if (argc != 3)
+	{
+		cerr << "Usage: " << argv[0] << " input.in output.bin" << endl;
+		return 1;
+	}
+
+	int ncases = convertCaseFile(argv[1], argv[2]);
+	if (ncases < 0)
+		return 1;
+	cout << ncases << " cases written to " << argv[2] << endl;
+	return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * test_CaseFile.cpp
+ *
+ * Descp: To test the binary files of cases (CaseFile.h header)
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: test_cases.in converted into a binary file, and some broken binary files.
+ * 
+ * Post: If the tests were ok or not.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include <iostream>
+#include <vector>
+#include <cstdio>       /* fopen, remove */
+#include <cstring>      /* memcmp */
+#include "PathPlanning.h"
+
+typedef bool (*ArrayOfTests[]) (); 
+using namespace std;
+
+const char* CASES_FILE = "../test_cases.in";
+const char* BINARY_FILE = "test_CaseFile.tmp";
+
+/**
+ * Overwrites size bytes of the file, from offset on
+ */
+bool patchFile(const char *filePath, long offset, const void *bytes, size_t size)
+{
+	FILE *file = fopen(filePath, "r+b");
+	bool ok = file != NULL && fseek(file, offset, SEEK_SET) == 0 && fwrite(bytes, 1, size, file) == size;
+	return file != NULL && fclose(file) == 0 && ok;
+}
+
+/**
+ * The mapped cases are the same as the parsed ones, and the obstacles are used in place
+ */
+bool testConvert()
+{
+	CaseSet text;
+	MappedCaseFile binary;
+	bool passed = readFile(CASES_FILE, text, PathOptions()) && convertCaseFile(CASES_FILE, BINARY_FILE) == 3
+		&& isCaseFile(BINARY_FILE) && !isCaseFile(CASES_FILE) && binary.open(BINARY_FILE)
+		&& binary.size() == text.size() && binary.maxPointsObstacle() == text.maxPointsObstacle;
+	
+	for (int i = 0; passed && i < text.size(); i++)
+	{
+		const testCase &c = binary.getCase(i), &expected = text.cases[i];
+		passed = binary.isValid(c) && c.nPointsObstacle == expected.nPointsObstacle
+			&& c.obstacleOffset == expected.obstacleOffset && memcmp(&c.init, &expected.init, sizeof(Point2f)) == 0
+			&& memcmp(&c.dest, &expected.dest, sizeof(Point2f)) == 0
+			&& memcmp(binary.obstacle(c), text.obstacle(expected), c.nPointsObstacle * sizeof(Point2f)) == 0;
+		cout << "Case " << i << ": " << c.nPointsObstacle << " points, " << (passed ? "ok" : "wrong") << endl;
+	}
+	
+	//Points right after the table, aligned
+	const char *table = reinterpret_cast<const char*>(&binary.getCase(0));
+	const char *points = reinterpret_cast<const char*>(binary.obstacle(binary.getCase(0)));
+	return passed && points - table >= 3 * (long) sizeof(testCase) && (points - table + 40) % 64 == 0;
+}
+
+/**
+ * Both files give the same results
+ */
+bool testSolve()
+{
+	PathOptions options;
+	options.quiet = true;
+	vector<CaseSummary> text, binary;
+	int ncases = solveFile(CASES_FILE, options, [&text](const CaseSummary &s, const CaseTrace*) { text.push_back(s); });
+	int nbinary = solveFile(BINARY_FILE, options, [&binary](const CaseSummary &s, const CaseTrace*) { binary.push_back(s); });
+	
+	bool passed = ncases == 3 && nbinary == 3 && binary.size() == 3;
+	for (int i = 0; passed && i < 3; i++)
+	{
+		printCaseSummary(binary[i]);
+		passed = binary[i].caseIndex == i && binary[i].nPoints == text[i].nPoints
+			&& binary[i].hullSize == text[i].hullSize && binary[i].pathSize == text[i].pathSize
+			&& binary[i].isUpperShortest == text[i].isUpperShortest && binary[i].length == text[i].length
+			&& binary[i].sameResults;
+	}
+	return passed;
+}
+
+/**
+ * Broken files are not opened, or their wrong cases are detected
+ */
+bool testBrokenFiles()
+{
+	MappedCaseFile binary;
+	bool passed = true;
+	
+	//Wrong offset of case 1
+	int offset = 1000;
+	passed = passed && patchFile(BINARY_FILE, sizeof(CaseFileHeader) + sizeof(testCase) + 2*sizeof(Point2f), &offset, sizeof(offset))
+		&& binary.open(BINARY_FILE) && binary.isValid(binary.getCase(0)) && !binary.isValid(binary.getCase(1));
+	PathOptions options;
+	options.quiet = true;
+	int solved = 0;
+	passed = passed && solveFile(BINARY_FILE, options, [&solved](const CaseSummary&, const CaseTrace*) { solved++; }) == -1
+		&& solved == 1;
+	
+	//An offset of the points which wraps around when their size is added to it
+	uint64_t pointsOffset = ~(uint64_t) (CASE_FILE_ALIGNMENT - 1);
+	passed = passed && patchFile(BINARY_FILE, 32, &pointsOffset, sizeof(pointsOffset)) && !binary.open(BINARY_FILE);
+	cout << "Error: " << binary.error() << endl;
+	passed = passed && convertCaseFile(CASES_FILE, BINARY_FILE) == 3;
+	
+	//A biggest obstacle which would overflow the size of the PathScratch, and one bigger than all the points
+	uint32_t maxPoints = 0xFFFFFFF0u;
+	passed = passed && patchFile(BINARY_FILE, 20, &maxPoints, sizeof(maxPoints)) && !binary.open(BINARY_FILE);
+	cout << "Error: " << binary.error() << endl;
+	maxPoints = 1000;
+	passed = passed && patchFile(BINARY_FILE, 20, &maxPoints, sizeof(maxPoints)) && !binary.open(BINARY_FILE);
+	passed = passed && convertCaseFile(CASES_FILE, BINARY_FILE) == 3;
+	
+	//More points than the ones in the file
+	uint64_t points = 1000;
+	passed = passed && patchFile(BINARY_FILE, 24, &points, sizeof(points)) && !binary.open(BINARY_FILE);
+	cout << "Error: " << binary.error() << endl;
+	
+	//Another byte order
+	uint32_t byteOrder = 0x04030201;
+	passed = passed && patchFile(BINARY_FILE, 8, &byteOrder, sizeof(byteOrder)) && !binary.open(BINARY_FILE);
+	cout << "Error: " << binary.error() << endl;
+	
+	passed = passed && !binary.open(CASES_FILE) && !binary.open("this file doesn't exist") && !binary.isOpen();
+	remove(BINARY_FILE);
+	return passed;
+}
+
+int main(int argc, char **argv)
+{
+	int failedTests = 0;
+	cout << "Testing the binary files of cases..." << endl << endl;
+	
+	ArrayOfTests tests = {testConvert,testSolve,testBrokenFiles};
+	
+	for (int i = 0; i<3; i++)
+	{
+		cout << "Starting test number " << i+1 << endl;
+		if (tests[i]())
+			cout << "The test " << i+1 << " was successfully passed!" << endl;
+		else
+		{
+			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
+		cout << "==================================================" << endl << endl;
+	}
+	
+	return failedTests > 0 ? 1 : 0;
+}
@@ -0,0 +1,204 @@
+/*
+ * test_CaseReader.cpp
+ *
+ * Descp: To test the streaming reader of cases files (CaseReader.h header)
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: numbers parsed by parseFloat and parseInt, compared with strtof and strtol, and test_cases.in and
+ * 		other small files (comments, windows ends of line, errors...) read by chunks of different sizes.
+ * 
+ * Post: If the tests were ok or not.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdio>       /* snprintf */
+#include <cstring>      /* strlen, memcmp */
+#include <climits>      /* INT_MAX, INT_MIN */
+#include <stdlib.h>     /* srand, rand, strtof */
+#include "CaseReader.h"
+
+typedef bool (*ArrayOfTests[]) (); 
+using namespace std;
+
+const char* CASES_FILE = "../test_cases.in";
+
+/**
+ * parseFloat must give the same float as strtof, bit by bit, and stop at the same character
+ */
+bool sameAsStrtof(const char *number)
+{
+	const char *last = number + strlen(number);
+	float value = 0;
+	const char *end = parseFloat(number, last, value);
+	char *expectedEnd;
+	float expected = strtof(number, &expectedEnd);
+	
+	bool same = (expectedEnd == number) ? end == NULL
+		: end == expectedEnd && memcmp(&value, &expected, sizeof(float)) == 0;
+	if (!same)
+		cout << "Different parse of " << number << ": " << value << " instead of " << expected << endl;
+	return same;
+}
+
+bool testParseFloat()
+{
+	const char* numbers[] = {"0", "-0", "+1", "12.45", "0.004", "-0.34", "3.0001", "16777216", "16777217",
+		"123456789", "1234567890123", "0.1", "0.30000001", "1e10", "1e-10", "1.5e+3", "2.5E-7", "1e38", "1e39",
+		"1e-45", "7.006492e-46", "00000000000001.5", "1.00000000000000000001", ".5", "5.", "1.5x", "1.5e", "1e+",
+		"inf", "-infinity", "nan", "", "-", ".", "abc", "e5", "99999999999999999999999999999999999999999",
+		"0.1000000000000000000000000000000000000000000000000000000000000000000000000001",
+		"-1234567890123456789012345678901234567890123456789012345678901234567890e-60"};
+	bool passed = true;
+	for (unsigned int i = 0; i < sizeof(numbers) / sizeof(numbers[0]); i++)
+		passed = sameAsStrtof(numbers[i]) && passed;
+	
+	//Random numbers with several formats
+	const char* formats[] = {"%.1f", "%.3f", "%.5g", "%.7g", "%.9g", "%e", "%.2e", "%.12f"};
+	char number[64];
+	for (int i = 0; i < 200000 && passed; i++)
+	{
+		double x = (rand() - RAND_MAX / 2.0) / (1 + rand() % 100000);
+		if (i % 3 == 0)
+			x *= 1e-8 * (rand() % 1000);
+		snprintf(number, sizeof(number), formats[i % 8], x);
+		passed = sameAsStrtof(number);
+	}
+	return passed;
+}
+
+bool testParseInt()
+{
+	const char* numbers[] = {"15", "-3", "+7", "0", "2147483647", "-2147483648", "12abc"};
+	const int expected[] = {15, -3, 7, 0, INT_MAX, INT_MIN, 12};
+	bool passed = true;
+	for (int i = 0; i < 7; i++)
+	{
+		int value;
+		const char *last = numbers[i] + strlen(numbers[i]);
+		const char *end = parseInt(numbers[i], last, value);
+		passed = passed && end != NULL && value == expected[i] && (i < 6 ? end == last : *end == 'a');
+	}
+	
+	const char* wrong[] = {"", "-", "abc", "2147483648", "-2147483649", "99999999999"};
+	for (int i = 0; i < 6; i++)
+	{
+		int value;
+		passed = passed && parseInt(wrong[i], wrong[i] + strlen(wrong[i]), value) == NULL;
+	}
+	return passed;
+}
+
+/**
+ * Reads all the cases of a reader into cases
+ */
+bool readAll(CaseReader &reader, CaseSet &cases)
+{
+	if (!reader.readHeader())
+		return false;
+	while (reader.casesRead() < reader.numberOfCases())
+		if (!reader.readCase(cases))
+			return false;
+	return true;
+}
+
+/**
+ * test_cases.in, read with chunks from 1 byte (every token is split between chunks) to the default size
+ */
+bool testChunks()
+{
+	bool passed = true;
+	for (int chunkSize = 1; chunkSize <= CaseReader::DEFAULT_CHUNK_SIZE && passed; chunkSize *= 3)
+	{
+		CaseReader reader(CASES_FILE, chunkSize);
+		CaseSet cases;
+		passed = reader.isOpen() && readAll(reader, cases) && cases.size() == 3 && cases.points.size() == 5 + 6 + 15
+			&& cases.maxPointsObstacle == 15 && cases.cases[1].nPointsObstacle == 6 && cases.cases[1].obstacleOffset == 5
+			&& cases.cases[0].init.x() == 1 && cases.cases[0].init.y() == 1
+			&& cases.cases[1].dest.x() == 11 && cases.cases[1].dest.y() == 0
+			&& cases.obstacle(cases.cases[1])[1].x() == 3.0001f && cases.obstacle(cases.cases[1])[1].y() == 2
+			&& cases.obstacle(cases.cases[2])[14].x() == 5.7f && cases.obstacle(cases.cases[2])[14].y() == 1.45f
+			&& !reader.readCase(cases);
+		cout << "Chunks of " << chunkSize << " bytes: " << (passed ? "ok" : "wrong") << endl;
+	}
+	return passed;
+}
+
+/**
+ * Comments between cases, windows ends of line, a case without obstacle, the number of points in the same
+ * line of the points, no end for the last case, and no end of line at the end of the file.
+ */
+bool testFormat()
+{
+	const string text = "NUMCASES 3\r\n"
+		"some comment\r\n\r\n"
+		"case 0 begin\r\n-1 0\r\n1 0\r\n2\r\n0 1\r\n0.5 -1e-1\r\nend\r\n"
+		"# another comment, and an empty line\n\n"
+		"case 1 begin\n 2.5\t3\n4 4\n0\nend\n"
+		"case 2 begin\n0 0\n10 0\n1 5 5\n";
+	
+	CaseReader reader(text.data(), text.size());
+	CaseSet cases;
+	bool passed = readAll(reader, cases) && cases.size() == 3 && cases.points.size() == 3
+		&& cases.cases[0].nPointsObstacle == 2 && cases.obstacle(cases.cases[0])[1].y() == -0.1f
+		&& cases.cases[1].init.x() == 2.5f && cases.cases[1].nPointsObstacle == 0
+		&& cases.cases[2].obstacleOffset == 2 && cases.obstacle(cases.cases[2])[0].x() == 5;
+	cout << "Read " << cases.size() << " cases, with " << cases.points.size() << " points" << endl;
+	return passed;
+}
+
+/**
+ * Wrong cases: the error and its line are reported, and nothing is appended to the set of cases
+ */
+bool testErrors()
+{
+	const string wrongPoint = "NUMCASES 2\ncase 0 begin\n0 0\n1 1\n1\n2 2\nend\ncase 1 begin\n0 0\n1 1\n2\n3 3\n3 x\nend\n";
+	CaseReader reader(wrongPoint.data(), wrongPoint.size());
+	CaseSet cases;
+	bool passed = !readAll(reader, cases) && cases.size() == 1 && cases.points.size() == 1 && reader.line() == 13
+		&& cases.maxPointsObstacle == 1;
+	cout << "Error: " << reader.error() << ", line " << reader.line() << endl;
+	
+	const string missingCase = "NUMCASES 2\ncase 0 begin\n0 0\n1 1\n0\nend\n";
+	CaseReader reader2(missingCase.data(), missingCase.size());
+	cases.clear();
+	passed = passed && !readAll(reader2, cases) && cases.size() == 1;
+	cout << "Error: " << reader2.error() << ", line " << reader2.line() << endl;
+	
+	const string noHeader = "case 0 begin\n0 0\n1 1\n0\nend\n";
+	CaseReader reader3(noHeader.data(), noHeader.size());
+	passed = passed && !reader3.readHeader();
+	
+	CaseReader reader4("this file doesn't exist");
+	return passed && !reader4.isOpen() && !reader4.readHeader();
+}
+
+int main(int argc, char **argv)
+{
+	int failedTests = 0;
+	cout << "Testing the reader of cases..." << endl << endl;
+	
+	ArrayOfTests tests = {testParseFloat,testParseInt,testChunks,testFormat,testErrors};
+	
+	for (int i = 0; i<5; i++)
+	{
+		cout << "Starting test number " << i+1 << endl;
+		if (tests[i]())
+			cout << "The test " << i+1 << " was successfully passed!" << endl;
+		else
+		{
+			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
+		cout << "==================================================" << endl << endl;
+	}
+	
+	return failedTests > 0 ? 1 : 0;
+}
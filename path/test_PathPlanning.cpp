@@ -0,0 +1,244 @@
+/*
+ * test_PathPlanning.cpp
+ *
+ * Descp: To test the robot path planning (PathPlanning.h header)
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: the cases of test_cases.in, read quietly and verbosely, and solved, some big obstacles, and a file of
+ * 		many cases solved in parallel.
+ * 
+ * Post: If the tests were ok or not.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include <iostream>
+#include <sstream>
+#include <cmath>        /* fabs */
+#include <stdlib.h>     /* rand */
+#include <cstdio>       /* fopen, remove */
+#include <vector>
+#include "PathPlanning.h"
+
+typedef bool (*ArrayOfTests[]) (); 
+using namespace std;
+
+const char* CASES_FILE = "../test_cases.in";
+const char* MANY_CASES_FILE = "test_PathPlanning.tmp";
+const char* MANY_CASES_BINARY_FILE = "test_PathPlanning.bin.tmp";
+
+/**
+ * Case 0 of test_cases.in: the shortest path is the upper mid hull, (1,1) (2.25,2.5) (5,2)
+ */
+bool testShortestPath()
+{
+	const Point2f obstacle[] = {Point2f(2, 0.4f), Point2f(2.25f, 2.5f), Point2f(3, 1.25f), Point2f(3.5f, 2), Point2f(4, 0.75f)};
+	CaseSet cases;
+	cases.add(Point2f(1, 1), Point2f(5, 2), obstacle, 5);
+	
+	PathScratch scratch;
+	CaseSummary summary;
+	CaseTrace trace;
+	solveCase(cases, 0, scratch, summary, &trace);
+	
+	vector<Point2f> expected = {Point2f(1, 1), Point2f(2.25f, 2.5f), Point2f(5, 2)};
+	float expectedLength = Point2f(1, 1).distanceBetweenTwoPoints(Point2f(2.25f, 2.5f))
+		+ Point2f(2.25f, 2.5f).distanceBetweenTwoPoints(Point2f(5, 2));
+	cout << "Path of " << summary.pathSize << " points, with length " << summary.length << endl;
+	
+	return summary.sameResults && summary.isUpperShortest && summary.nPoints == 7 && summary.hullSize == 5
+		&& summary.pathSize == 3 && fabs(summary.length - expectedLength) < 0.0001f
+		&& trace.iterative.shortest() == expected && trace.divideAndConquer.shortest() == expected;
+}
+
+/**
+ * In quiet mode, reading and solving the cases doesn't write anything
+ */
+bool testQuiet()
+{
+	ostringstream captured;
+	streambuf *coutBuffer = cout.rdbuf(captured.rdbuf());
+	
+	PathOptions options;
+	options.quiet = true;
+	CaseSet cases;
+	bool read = readFile(CASES_FILE, cases, options);
+	
+	PathScratch scratch;
+	bool passed = read && cases.size() == 3;
+	for (int i = 0; i<cases.size(); i++)
+	{
+		CaseSummary summary;
+		solveCase(cases, i, scratch, summary);
+		passed = passed && summary.sameResults;
+	}
+	
+	cout.rdbuf(coutBuffer);
+	cout << "Output in quiet mode: \"" << captured.str() << "\"" << endl;
+	return passed && captured.str().empty();
+}
+
+/**
+ * The summary line of every case, and the verbose output of the same cases
+ */
+bool testSummary()
+{
+	CaseSet cases;
+	ostringstream verbose;
+	streambuf *coutBuffer = cout.rdbuf(verbose.rdbuf());
+	bool read = readFile(CASES_FILE, cases);
+	cout.rdbuf(coutBuffer);
+	if (!read)
+		return false;
+	
+	PathScratch scratch;
+	ostringstream summaries;
+	for (int i = 0; i<cases.size(); i++)
+	{
+		CaseSummary summary;
+		CaseTrace trace;
+		solveCase(cases, i, scratch, summary, &trace);
+		printCaseSummary(summary, summaries);
+		printCaseTrace(summary, trace, verbose);
+	}
+	cout << summaries.str();
+	
+	return summaries.str() ==
+		"case=0 points=7 hull=5 path=upper pathPoints=3 length=4.74765 check=ok\n"
+		"case=1 points=8 hull=4 path=upper pathPoints=3 length=13.6314 check=ok\n"
+		"case=2 points=17 hull=6 path=lower pathPoints=4 length=20.1466 check=ok\n"
+		&& verbose.str().find("Reading case 2") != string::npos
+		&& verbose.str().find("----->Running case 2<-----") != string::npos;
+}
+
+/**
+ * Obstacles of any size (there were 15 points at most), stored in the same arena, and solved with the
+ * same scratch buffer: once it is reserved for the biggest case, it is not reallocated.
+ */
+bool testBigObstacles()
+{
+	const int N_CASES = 50;
+	CaseSet cases;
+	vector<Point2f> obstacle;
+	for (int c = 0; c<N_CASES; c++)
+	{
+		//n random points in [-50,50] x [-30,70], between A = (-100,0) and B = (100,0)
+		int n = 40 * (c+1);
+		obstacle.clear();
+		for (int i = 0; i<n; i++)
+			obstacle.push_back(Point2f((rand() % 100000) / 1000.0f - 50, (rand() % 100000) / 1000.0f - 30));
+		cases.add(Point2f(-100, 0), Point2f(100, 0), obstacle.data(), n);
+	}
+	
+	PathScratch scratch;
+	scratch.reserve(cases.maxPointsObstacle + 2);
+	const Point2f *buffer = scratch.buffer.data();
+	
+	bool passed = cases.maxPointsObstacle == 40 * N_CASES;
+	for (int c = 0; c<N_CASES && passed; c++)
+	{
+		CaseSummary summary;
+		solveCase(cases, c, scratch, summary);
+		//The path goes below the obstacle (lower mid hull), which is closer to the line A-B
+		passed = summary.sameResults && !summary.isUpperShortest && summary.pathSize >= 3
+			&& cases.obstacle(cases.cases[c]) == &cases.points[cases.cases[c].obstacleOffset];
+	}
+	cout << "Cases of up to " << cases.maxPointsObstacle << " points, in an arena of " << cases.points.size() << endl;
+	
+	return passed && scratch.buffer.data() == buffer;
+}
+
+/**
+ * Summaries of all the cases of a file
+ */
+vector<CaseSummary> solveQuietly(const char *filePath, PathOptions options, int &ncases)
+{
+	vector<CaseSummary> summaries;
+	options.quiet = true;
+	ncases = solveFile(filePath, options, [&summaries](const CaseSummary &s, const CaseTrace*) { summaries.push_back(s); });
+	return summaries;
+}
+
+bool sameSummary(const CaseSummary &a, const CaseSummary &b)
+{
+	return a.caseIndex == b.caseIndex && a.nPoints == b.nPoints && a.hullSize == b.hullSize && a.pathSize == b.pathSize
+		&& a.isUpperShortest == b.isUpperShortest && a.length == b.length;
+}
+
+/**
+ * Several batches of cases solved by several threads give the same summaries, in the same order, as one
+ * thread, from the text and the binary files. Sampled checks are done on the same cases always.
+ */
+bool testParallel()
+{
+	const int N_CASES = 10000;
+	FILE *file = fopen(MANY_CASES_FILE, "w");
+	if (file == NULL)
+		return false;
+	fprintf(file, "NUMCASES %d\n", N_CASES);
+	for (int c = 0; c<N_CASES; c++)
+	{
+		int n = 3 + rand() % 300;
+		fprintf(file, "case %d begin\n-100 0\n100 0\n%d\n", c, n);
+		for (int i = 0; i<n; i++)
+			fprintf(file, "%g %g\n", (rand() % 100000) / 1000.0f - 50, (rand() % 100000) / 1000.0f - 30);
+		fprintf(file, "end\n");
+	}
+	fclose(file);
+	
+	int ncases = 0, nparallel = 0, nsampled = 0, nbinary = 0;
+	PathOptions options;
+	vector<CaseSummary> sequential = solveQuietly(MANY_CASES_FILE, options, ncases);
+	options.threads = 4;
+	vector<CaseSummary> parallel = solveQuietly(MANY_CASES_FILE, options, nparallel);
+	options.check = CHECK_SAMPLED;
+	options.checkEvery = 7;
+	vector<CaseSummary> sampled = solveQuietly(MANY_CASES_FILE, options, nsampled);
+	options.check = CHECK_ALWAYS;
+	vector<CaseSummary> binary = convertCaseFile(MANY_CASES_FILE, MANY_CASES_BINARY_FILE) == N_CASES
+		? solveQuietly(MANY_CASES_BINARY_FILE, options, nbinary) : vector<CaseSummary>();
+	remove(MANY_CASES_FILE);
+	remove(MANY_CASES_BINARY_FILE);
+	
+	bool passed = ncases == N_CASES && nparallel == N_CASES && nsampled == N_CASES && nbinary == N_CASES
+		&& (int) sequential.size() == N_CASES && (int) parallel.size() == N_CASES && (int) sampled.size() == N_CASES
+		&& (int) binary.size() == N_CASES;
+	int nChecked = 0;
+	for (int c = 0; c<N_CASES && passed; c++)
+	{
+		passed = sequential[c].caseIndex == c && sequential[c].sameResults && sequential[c].isChecked
+			&& sameSummary(sequential[c], parallel[c]) && parallel[c].sameResults
+			&& sameSummary(sequential[c], sampled[c]) && sampled[c].sameResults && sampled[c].isChecked == (c % 7 == 0)
+			&& sameSummary(sequential[c], binary[c]) && binary[c].sameResults;
+		nChecked += sampled[c].isChecked;
+	}
+	cout << N_CASES << " cases solved by " << options.threads << " threads, " << nChecked << " checked when sampled" << endl;
+	return passed;
+}
+
+int main(int argc, char **argv)
+{
+	int failedTests = 0;
+	cout << "Testing the robot path planning..." << endl << endl;
+	
+	ArrayOfTests tests = {testShortestPath,testQuiet,testSummary,testBigObstacles,testParallel};
+	
+	for (int i = 0; i<5; i++)
+	{
+		cout << "Starting test number " << i+1 << endl;
+		if (tests[i]())
+			cout << "The test " << i+1 << " was successfully passed!" << endl;
+		else
+		{
+			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
+		cout << "==================================================" << endl << endl;
+	}
+	
+	return failedTests > 0 ? 1 : 0;
+}
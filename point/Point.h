@@ -0,0 +1,165 @@
+#ifndef POINT_H
+#define POINT_H
+
+#include <cmath>
+#include <cstdlib> //abs for integers
+#include <type_traits>
+#include <stdint.h>
+
+//128 bits integers (GCC and Clang on 64 bits machines), for the exact cross products of int64_t coordinates
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+
+/**
+ * Coordinate types of the points: float, double, int32_t and int64_t.
+ * Cross is the type of the cross products of the orientation tests (see orientation.h). For integers it
+ * is exact (64 bits for int32_t, 128 bits for int64_t) as long as every coordinate is in
+ * [-maxCoordinate, maxCoordinate], so the difference of two coordinates fits in the coordinate type.
+ * Distance is the type of the distances between points.
+ */
+template<class T> struct CoordinateTraits;
+
+template<> struct CoordinateTraits<float>
+{
+	typedef double Cross;
+	typedef float Distance;
+	static const bool exact = false;
+};
+
+template<> struct CoordinateTraits<double>
+{
+	typedef double Cross;
+	typedef double Distance;
+	static const bool exact = false;
+};
+
+template<> struct CoordinateTraits<int32_t>
+{
+	typedef int64_t Cross;
+	typedef double Distance;
+	static const bool exact = true;
+	static const int32_t maxCoordinate = (1 << 30) - 1;
+};
+
+template<> struct CoordinateTraits<int64_t>
+{
+	typedef int128_t Cross;
+	typedef double Distance;
+	static const bool exact = true;
+	static const int64_t maxCoordinate = ((int64_t) 1 << 62) - 1;
+};
+
+/**
+ * Point of the plane with coordinates of type T (see CoordinateTraits).
+ * Point<T> is a trivial and standard-layout type: copies, assignments and arrays of points are just
+ * memory copies of two coordinates, so they can be copied with memcpy or mapped from a file.
+ * Note that, because of that, the default constructor doesn't initialize the coordinates.
+ * Use Point2f() or Point2f p{} for a point with both coordinates to 0.
+ */
+template<class T>
+class Point
+{
+    public:
+        typedef T Coordinate;
+        typedef typename CoordinateTraits<T>::Distance Distance;
+
+        Point() = default;
+        constexpr Point(T x, T y) : m_coord{x, y} {}
+
+        /** Comparison operator
+         *  \param other point to compare with
+         *  \return true if the point is the same or describe the same coordinates
+         *  		false otherwise.
+         *  Floating point coordinates are compared with a tolerance, integer ones exactly.
+         */
+        bool operator==(const Point& other) const;
+
+		/**
+		 * 'Greater than' operator
+		 * \param other point to compare with.
+         *  \return I define one point greater than another, If the former has got a greater x-value.
+         * If both x-values are the same, it compares the y-values.
+         * If both have equal x- and y-values, then this can return either false or true.
+		 */
+		 bool operator>(const Point& other) const;
+		
+		// the following getters/setters will be inlined (little more efficient)
+		/* Getters */
+        constexpr T x() const { return m_coord[0]; }
+        constexpr T y() const { return m_coord[1]; }
+        
+        /* Setters */
+        Point& x(T newX) { m_coord[0] = newX; return *this; }
+		Point& y(T newY) { m_coord[1] = newY; return *this; }
+		
+		/* Others */
+		Distance distanceBetweenTwoPoints (const Point& other) const;
+		
+    private:
+        T m_coord [2];
+};
+
+typedef Point<float> Point2f;
+typedef Point<double> Point2d;
+typedef Point<int32_t> Point2i;
+typedef Point<int64_t> Point2l;
+
+static_assert(std::is_trivial<Point2f>::value && std::is_trivial<Point2d>::value
+	&& std::is_trivial<Point2i>::value && std::is_trivial<Point2l>::value, "Points must be trivial types");
+static_assert(std::is_standard_layout<Point2f>::value && std::is_standard_layout<Point2d>::value
+	&& std::is_standard_layout<Point2i>::value && std::is_standard_layout<Point2l>::value,
+	"Points must be standard-layout types");
+static_assert(sizeof(Point2f) == 2*sizeof(float) && sizeof(Point2d) == 2*sizeof(double)
+	&& sizeof(Point2i) == 2*sizeof(int32_t) && sizeof(Point2l) == 2*sizeof(int64_t),
+	"Points must be just two packed coordinates");
+
+/**
+ * Since some float numbers can't be represented accurately in the machine, we have to compare the diference
+ * with an epsilon. Integers are compared exactly.
+ */
+template<class T>
+inline bool sameCoordinate(T a, T b)
+{
+	return CoordinateTraits<T>::exact ? a == b : std::abs(a - b) < (T) 0.000001;
+}
+
+template<class T>
+bool Point<T>::operator==(const Point<T> &other) const
+{
+    if (this == &other)
+    	return false;
+    else 
+		return sameCoordinate(this->m_coord[0], other.m_coord[0])
+    			&& sameCoordinate(this->m_coord[1], other.m_coord[1]);
+}
+
+template<class T>
+bool Point<T>::operator>(const Point<T>& other) const
+{
+	if (sameCoordinate(this->m_coord[0], other.m_coord[0]))
+	{
+		if (this->m_coord[1] > other.m_coord[1])
+			return true;
+		else
+			return false;
+	}
+	
+	else if (this->m_coord[0]>other.m_coord[0])
+		return true;
+	else
+		return false;
+	
+}
+
+/**
+ * Calculates the distance between two points using the Pitagoras' Theorem (or vector modulo, which is the same)
+ */
+template<class T>
+typename Point<T>::Distance Point<T>::distanceBetweenTwoPoints (const Point<T>& other) const{
+	Distance leg_x = (Distance) other.m_coord[0] - this->m_coord[0];
+	Distance leg_y = (Distance) other.m_coord[1] - this->m_coord[1];
+	return std::hypot(leg_x,leg_y); //since c+11, hypot() is provided by cmath; otherwise I could use: sqrt(pow(leg_x,2) + pow(leg_y,2));
+	
+}
+
+#endif // POINT_H
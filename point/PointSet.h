@@ -0,0 +1,134 @@
+#ifndef POINTSET_H
+#define POINTSET_H
+
+#include <cstring>	//memcpy
+#include <stdint.h>	//uintptr_t
+#include "Point.h"
+#include <vector>
+
+/**
+ * Set of points stored as a structure of arrays: all the x-values in one contiguous array and all the
+ * y-values in another one, instead of an array of Point2f (x and y interleaved).
+ * Both arrays start at a multiple of ALIGNMENT bytes, so they can be processed by SIMD instructions
+ * (8 or 16 floats at a time) without extra code for the first unaligned elements.
+ */
+class PointSet
+{
+    public:
+        //Alignment in bytes of both arrays (a cache line, and an AVX-512 register)
+        static const int ALIGNMENT = 64;
+        
+        PointSet();
+        //Set of n points, whose coordinates are not initialized
+        explicit PointSet(int n);
+        //From an array of points
+        PointSet(const Point2f points[], int n);
+        //From two arrays with the x and y values (columns)
+        PointSet(const float x[], const float y[], int n);
+        PointSet(const PointSet& other);
+        PointSet& operator=(const PointSet& other);
+        ~PointSet();
+        
+        int size() const { return m_size; }
+        
+        /* Columns */
+        float* x() { return m_x; }
+        float* y() { return m_y; }
+        const float* x() const { return m_x; }
+        const float* y() const { return m_y; }
+        
+        /* Points */
+        Point2f operator[](int i) const { return Point2f(m_x[i], m_y[i]); }
+        void set(int i, const Point2f& p) { m_x[i] = p.x(); m_y[i] = p.y(); }
+        
+        /* Conversion to array of points */
+        void toPoints(Point2f points[]) const;
+        std::vector<Point2f> toPoints() const;
+        
+    private:
+        int m_size;
+        float *m_x, *m_y;
+        char *m_memory;	//allocated block with both arrays
+        
+        void allocate(int n);
+};
+/**
+ * Allocates one block for both arrays. The x array is rounded up to a multiple of ALIGNMENT bytes,
+ * so the y array is aligned too.
+ */
+inline void PointSet::allocate(int n)
+{
+	const int floatsPerLine = ALIGNMENT / sizeof(float);
+	int paddedSize = (n + floatsPerLine - 1) / floatsPerLine * floatsPerLine;
+	
+	m_size = n;
+	m_memory = new char[2 * paddedSize * sizeof(float) + ALIGNMENT];
+	uintptr_t address = reinterpret_cast<uintptr_t>(m_memory);
+	m_x = reinterpret_cast<float*>((address + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT);
+	m_y = m_x + paddedSize;
+}
+
+inline PointSet::PointSet()
+{
+	allocate(0);
+}
+
+inline PointSet::PointSet(int n)
+{
+	allocate(n);
+}
+
+inline PointSet::PointSet(const Point2f points[], int n)
+{
+	allocate(n);
+	for (int i = 0; i<n; i++)
+	{
+		m_x[i] = points[i].x();
+		m_y[i] = points[i].y();
+	}
+}
+
+inline PointSet::PointSet(const float x[], const float y[], int n)
+{
+	allocate(n);
+	std::memcpy(m_x, x, n * sizeof(float));
+	std::memcpy(m_y, y, n * sizeof(float));
+}
+
+inline PointSet::PointSet(const PointSet& other) : PointSet(other.m_x, other.m_y, other.m_size)
+{
+}
+
+inline PointSet& PointSet::operator=(const PointSet& other)
+{
+	if (this != &other)
+	{
+		//The old block is freed once the new one is filled, so this set is still valid if new throws
+		char *oldMemory = m_memory;
+		allocate(other.m_size);
+		std::memcpy(m_x, other.m_x, m_size * sizeof(float));
+		std::memcpy(m_y, other.m_y, m_size * sizeof(float));
+		delete[] oldMemory;
+	}
+	return *this;
+}
+
+inline PointSet::~PointSet()
+{
+	delete[] m_memory;
+}
+
+inline void PointSet::toPoints(Point2f points[]) const
+{
+	for (int i = 0; i<m_size; i++)
+		points[i] = Point2f(m_x[i], m_y[i]);
+}
+
+inline std::vector<Point2f> PointSet::toPoints() const
+{
+	std::vector<Point2f> points(m_size);
+	toPoints(points.data());
+	return points;
+}
+
+#endif // POINTSET_H
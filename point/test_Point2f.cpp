@@ -7,7 +7,7 @@
  ******************************************************************************
  *
  ******************************************************************************
- * Pre: Some tests for all functions of Point2f
+ * Pre: Some tests for all functions of Point2f, and for points with other coordinate types
  *
  * Post: Results of the tests
  *
@@ -16,9 +16,11 @@
  *      Author: Abel Serrano
  */
 
-#include "Point2f.cpp"
+#include "Point.h"
 #include <iostream>
 #include <assert.h>
+#include <cstring>		/* memcpy */
+#include <vector>
 
 typedef bool (*ArrayOfTests[]) (); 
 using namespace std;
@@ -27,7 +29,7 @@ bool testConstructors()
 {
 	cout << "Testing constructors..." << endl;
 	
-	Point2f p1;
+	Point2f p1 = Point2f();
 	assert(p1.x()==0);
 	assert(p1.y()==0);
 	cout << "Default values for a point: " << p1.x() << ", " << p1.y() << endl;
@@ -87,7 +89,7 @@ bool testComparison()
 {
 	cout << "Testing comparisons..." << endl;
 	
-	Point2f p1, p2;
+	Point2f p1 = Point2f(), p2 = Point2f();
 	assert(p1==p2);
 	cout << "Equals for default constructor" << endl;
 	
@@ -145,24 +147,73 @@ bool testDistancesBetweenPoints()
 	return true;
 }
 
+/**
+ * Points can be copied as raw memory
+ */
+bool testTrivialCopy()
+{
+	assert(std::is_trivially_copyable<Point2f>::value);
+	
+	Point2f points[] = {Point2f(1.5f,-2.0f), Point2f(3.25f,4.0f), Point2f(-7.0f,0.125f)};
+	float raw[6];
+	memcpy(raw, points, sizeof(points));
+	assert(raw[0]==1.5f && raw[1]==-2.0f && raw[4]==-7.0f && raw[5]==0.125f);
+	
+	Point2f copies[3];
+	memcpy(copies, raw, sizeof(raw));
+	std::vector<Point2f> v(copies, copies + 3);
+	assert(v[1].x()==3.25f && v[1].y()==4.0f);
+	
+	return true;
+}
+
+/**
+ * Points with double and integer coordinates: integers are compared exactly, doubles with the tolerance
+ */
+bool testCoordinateTypes()
+{
+	Point2d d1(0.1+0.2, 1e300), d2(0.3, 1e300);
+	assert(d1==d2);
+	assert(Point2d(0.3, 2) > Point2d(0.3 + 1e-9, 1));
+	assert(Point2d(3,4).distanceBetweenTwoPoints(Point2d(0,0)) == 5.0);
+	
+	Point2i i1(1 << 30, -7), i2(1 << 30, -6);
+	assert(!(i1==i2));
+	assert(i2 > i1 && !(i1 > i2));
+	assert(Point2i(-1, 5) > Point2i(-2, 100));
+	
+	Point2l l1((int64_t) 1 << 62, 1), l2(((int64_t) 1 << 62) + 1, 0);
+	assert(!(l1==l2));
+	assert(l2 > l1);
+	double d = Point2l(0,0).distanceBetweenTwoPoints(Point2l(3000000000LL, 4000000000LL));
+	assert(d == 5000000000.0);
+	
+	cout << "Comparisons and distances of double, int32_t and int64_t points" << endl;
+	return true;
+}
 
 int main(int argc, char **argv)
 {
+	int failedTests = 0;
 	cout << "Testing functions of Point3f ADT..." << endl << endl;
 	
-	ArrayOfTests tests = {testConstructors,testAssignment,testComparison,testDistancesBetweenPoints};
+	ArrayOfTests tests = {testConstructors,testAssignment,testComparison,testDistancesBetweenPoints,testTrivialCopy,
+		testCoordinateTypes};
 	
-	for (int i = 0; i<4; i++)
+	for (int i = 0; i<6; i++)
 	{
 		cout << "Starting test number " << i+1 << endl;
 		if (tests[i]())
 			cout << "The test " << i+1 << " was successfully passed!" << endl;
 		else
+		{
 			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
 		cout << "==================================================" << endl << endl;
 	}
 	
-	return 0;
+	return failedTests > 0 ? 1 : 0;
 	
 }
 
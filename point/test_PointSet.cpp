@@ -0,0 +1,113 @@
+/*
+ * test_PointSet.cpp
+ *
+ * Descp:
+ *  File for testing the ADT: PointSet
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: Some tests for all functions of PointSet
+ *
+ * Post: Results of the tests
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include "Point.h"
+#include "PointSet.h"
+#include <iostream>
+#include <assert.h>
+
+typedef bool (*ArrayOfTests[]) (); 
+using namespace std;
+
+static bool isAligned(const float* p)
+{
+	return reinterpret_cast<uintptr_t>(p) % PointSet::ALIGNMENT == 0;
+}
+
+bool testConstructors()
+{
+	cout << "Testing constructors..." << endl;
+	
+	PointSet empty;
+	assert(empty.size() == 0);
+	
+	Point2f points[] = {Point2f(1,2), Point2f(-3.5f,4), Point2f(5,-6.25f)};
+	PointSet s1(points, 3);
+	assert(s1.size() == 3);
+	assert(s1.x()[1] == -3.5f && s1.y()[1] == 4);
+	assert(s1[2].x() == 5 && s1[2].y() == -6.25f);
+	
+	float xs[] = {1,-3.5f,5}, ys[] = {2,4,-6.25f};
+	PointSet s2(xs, ys, 3);
+	for (int i = 0; i<3; i++)
+		assert(s2[i].x() == s1[i].x() && s2[i].y() == s1[i].y());
+	
+	PointSet s3(s2);
+	s2.set(0, Point2f(9,9));
+	assert(s3[0].x() == 1 && s3[0].y() == 2);	//deep copy
+	
+	s3 = s2;
+	assert(s3[0].x() == 9 && s3.size() == 3);
+	
+	return true;
+}
+
+bool testAlignment()
+{
+	cout << "Testing alignment of the columns..." << endl;
+	
+	bool aligned = true;
+	for (int n = 0; n<100 && aligned; n++)
+	{
+		PointSet s(n);
+		aligned = isAligned(s.x()) && isAligned(s.y()) && s.y() - s.x() >= n;
+	}
+	return aligned;
+}
+
+bool testConversion()
+{
+	cout << "Testing conversion to points..." << endl;
+	
+	const int N = 1000;
+	vector<Point2f> points(N);
+	for (int i = 0; i<N; i++)
+		points[i] = Point2f(i * 0.5f, -i * 2.0f);
+	
+	PointSet s(points.data(), N);
+	vector<Point2f> back = s.toPoints();
+	
+	bool equal = back.size() == (unsigned int) N;
+	for (int i = 0; i<N && equal; i++)
+		equal = back[i].x() == points[i].x() && back[i].y() == points[i].y();
+	return equal;
+}
+
+int main(int argc, char **argv)
+{
+	int failedTests = 0;
+	cout << "Testing functions of PointSet ADT..." << endl << endl;
+	
+	ArrayOfTests tests = {testConstructors,testAlignment,testConversion};
+	
+	for (int i = 0; i<3; i++)
+	{
+		cout << "Starting test number " << i+1 << endl;
+		if (tests[i]())
+			cout << "The test " << i+1 << " was successfully passed!" << endl;
+		else
+		{
+			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
+		cout << "==================================================" << endl << endl;
+	}
+	
+	return failedTests > 0 ? 1 : 0;
+	
+}
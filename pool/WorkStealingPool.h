@@ -0,0 +1,221 @@
+/*
+ * WorkStealingPool.h
+ *
+ * Descp: Pool of threads for fork/join tasks, used by the parallel divide and conquer (CH_Algorithms.h)
+ * and by the parallel path planning (path/PathPlanning.h).
+ *
+ * Every thread has its own queue of tasks and runs the newest one of it; when its queue is empty, it steals
+ * the oldest one from the queue of another thread. A thread waiting for its tasks runs other tasks meanwhile.
+ * The threads are created once, with the pool, so a pool can be reused by many algorithm calls (see
+ * HullOptions::dcPool).
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <functional>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * Pool of threads for fork/join parallelism (e.g. divide and conquer algorithms).
+ * Every thread has its own double-ended queue of tasks: it pushes and pops its new tasks at the back
+ * (the last one, whose data is still in cache), and when it runs out of tasks it steals the oldest one
+ * (the biggest one, in a divide and conquer) from the front of the queue of another thread.
+ * A thread waiting for a group of tasks doesn't sleep: it runs queued tasks meanwhile, so tasks can
+ * spawn other tasks and wait for them without deadlocks.
+ */
+class WorkStealingPool
+{
+    public:
+        typedef std::function<void()> Task;
+
+        //Tasks to wait for together
+        class TaskGroup
+        {
+            public:
+                TaskGroup() : m_pending(0) {}
+
+            private:
+                std::atomic<int> m_pending;	//tasks spawned and not finished yet
+                friend class WorkStealingPool;
+        };
+
+        //nThreads threads in total: nThreads-1 new ones, plus the thread which waits for the tasks
+        explicit WorkStealingPool(int nThreads);
+        ~WorkStealingPool();
+
+        int size() const { return m_queues.size(); }
+        //Index of the calling thread in [0, size()), e.g. for per-thread buffers: 0 for the threads which are
+        //not in the pool, so only one of them can use such buffers
+        int threadIndex() const { return queueIndex(); }
+
+        //Queues task, belonging to group, in the queue of the calling thread
+        void spawn(TaskGroup &group, const Task &task);
+        //Runs queued tasks until every task of group is finished
+        void wait(TaskGroup &group);
+
+    private:
+        struct QueuedTask
+        {
+            Task task;
+            TaskGroup *group;
+        };
+
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<QueuedTask> tasks;
+        };
+
+        std::vector<Queue> m_queues;	//m_queues[0] is shared by the threads which are not in the pool
+        std::vector<std::thread> m_threads;
+        std::atomic<int> m_queued;	//tasks in all the queues
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wakeUp;
+        bool m_stop;
+
+        //Pool and queue of the current thread, when it is one of the threads of a pool
+        struct ThreadIdentity
+        {
+            const WorkStealingPool *pool;
+            int queue;
+        };
+
+        WorkStealingPool(const WorkStealingPool&);
+        WorkStealingPool& operator=(const WorkStealingPool&);
+
+        static ThreadIdentity& currentThread();
+        int queueIndex() const;
+        bool runOne(int queue);
+        void worker(int queue);
+};
+
+/**
+ * The identity is a local variable of an inline function, so every translation unit which includes this
+ * header sees the same one (a thread_local variable at namespace scope would be one per unit)
+ */
+inline WorkStealingPool::ThreadIdentity& WorkStealingPool::currentThread()
+{
+	static thread_local ThreadIdentity identity = {NULL, 0};
+	return identity;
+}
+
+inline WorkStealingPool::WorkStealingPool(int nThreads)
+	: m_queues(nThreads > 1 ? nThreads : 1), m_queued(0), m_stop(false)
+{
+	for (int q = 1; q < size(); q++)
+		m_threads.push_back(std::thread(&WorkStealingPool::worker, this, q));
+}
+
+inline WorkStealingPool::~WorkStealingPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_sleepMutex);
+		m_stop = true;
+	}
+	m_wakeUp.notify_all();
+
+	for (unsigned int t = 0; t < m_threads.size(); t++)
+		m_threads[t].join();
+}
+
+inline int WorkStealingPool::queueIndex() const
+{
+	const ThreadIdentity &identity = currentThread();
+	return identity.pool == this ? identity.queue : 0;
+}
+
+inline void WorkStealingPool::spawn(TaskGroup &group, const Task &task)
+{
+	group.m_pending.fetch_add(1);
+
+	Queue &own = m_queues[queueIndex()];
+	{
+		std::lock_guard<std::mutex> lock(own.mutex);
+		QueuedTask queued = {task, &group};
+		own.tasks.push_back(queued);
+		m_queued.fetch_add(1);
+	}
+
+	//Taking the mutex, a thread can't miss the notification between checking m_queued and sleeping
+	{
+		std::lock_guard<std::mutex> lock(m_sleepMutex);
+	}
+	m_wakeUp.notify_one();
+}
+
+/**
+ * Runs the last task of the queue of this thread or, if it is empty, the first task of another queue.
+ * Returns false if there wasn't any task.
+ */
+inline bool WorkStealingPool::runOne(int queue)
+{
+	QueuedTask found;
+	bool isFound = false;
+
+	for (int i = 0; i < size() && !isFound; i++)
+	{
+		Queue &victim = m_queues[(queue + i) % size()];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if (!victim.tasks.empty())
+		{
+			if (i == 0)
+			{
+				found = victim.tasks.back();
+				victim.tasks.pop_back();
+			}
+			else
+			{
+				found = victim.tasks.front();
+				victim.tasks.pop_front();
+			}
+			m_queued.fetch_sub(1);
+			isFound = true;
+		}
+	}
+
+	if (isFound)
+	{
+		found.task();
+		found.group->m_pending.fetch_sub(1, std::memory_order_release);
+	}
+	return isFound;
+}
+
+inline void WorkStealingPool::wait(TaskGroup &group)
+{
+	int queue = queueIndex();
+	while (group.m_pending.load(std::memory_order_acquire) > 0)
+		if (!runOne(queue))
+			std::this_thread::yield();	//the remaining tasks are running in other threads
+}
+
+inline void WorkStealingPool::worker(int queue)
+{
+	ThreadIdentity &identity = currentThread();
+	identity.pool = this;
+	identity.queue = queue;
+
+	while (true)
+	{
+		if (!runOne(queue))
+		{
+			std::unique_lock<std::mutex> lock(m_sleepMutex);
+			m_wakeUp.wait(lock, [this] { return m_stop || m_queued.load() > 0; });
+			if (m_stop && m_queued.load() == 0)
+				return;
+		}
+	}
+}
+
+#endif // WORKSTEALINGPOOL_H
@@ -0,0 +1,132 @@
+/*
+ * test_WorkStealingPool.cpp
+ *
+ * Descp:
+ *  File for testing the pool of threads: WorkStealingPool
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: Some tests of independent and nested (fork/join) tasks, with different number of threads
+ *
+ * Post: Results of the tests
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include "WorkStealingPool.h"
+#include <iostream>
+#include <vector>
+
+typedef bool (*ArrayOfTests[]) ();
+using namespace std;
+
+/**
+ * Many independent tasks in the same group
+ */
+bool testManyTasks()
+{
+	const int N = 10000;
+	bool passed = true;
+	for (int nThreads = 1; nThreads <= 4 && passed; nThreads++)
+	{
+		WorkStealingPool pool(nThreads);
+		WorkStealingPool::TaskGroup group;
+		atomic<int> counter(0);
+		for (int i = 0; i < N; i++)
+			pool.spawn(group, [&counter] { counter.fetch_add(1); });
+		pool.wait(group);
+		cout << "Tasks run with " << nThreads << " threads: " << counter.load() << endl;
+		passed = counter.load() == N;
+	}
+	return passed;
+}
+
+static long long parallelSum(WorkStealingPool &pool, const int v[], int n)
+{
+	if (n <= 100)
+	{
+		long long sum = 0;
+		for (int i = 0; i < n; i++)
+			sum += v[i];
+		return sum;
+	}
+
+	long long left;
+	WorkStealingPool::TaskGroup group;
+	pool.spawn(group, [&] { left = parallelSum(pool, v, n / 2); });
+	long long right = parallelSum(pool, v + n / 2, n - n / 2);
+	pool.wait(group);
+	return left + right;
+}
+
+/**
+ * Divide and conquer: every task spawns another one and waits for it
+ */
+bool testForkJoin()
+{
+	const int N = 1000000;
+	vector<int> v(N);
+	long long expected = 0;
+	for (int i = 0; i < N; i++)
+	{
+		v[i] = i % 1000 - 500;
+		expected += v[i];
+	}
+
+	bool passed = true;
+	for (int nThreads = 1; nThreads <= 8 && passed; nThreads *= 2)
+	{
+		WorkStealingPool pool(nThreads);
+		long long sum = parallelSum(pool, v.data(), N);
+		cout << "Sum with " << nThreads << " threads: " << sum << ", expected " << expected << endl;
+		passed = sum == expected;
+	}
+	return passed;
+}
+
+/**
+ * The same pool, used for several groups of tasks one after another
+ */
+bool testReuse()
+{
+	WorkStealingPool pool(3);
+	bool passed = pool.size() == 3;
+	for (int round = 0; round < 100 && passed; round++)
+	{
+		WorkStealingPool::TaskGroup group;
+		vector<int> done(10, 0);
+		for (int i = 0; i < 10; i++)
+			pool.spawn(group, [&done, i, round] { done[i] = round + 1; });
+		pool.wait(group);
+		for (int i = 0; i < 10; i++)
+			passed = passed && done[i] == round + 1;
+	}
+	return passed;
+}
+
+int main(int argc, char **argv)
+{
+	int failedTests = 0;
+	cout << "Testing functions of WorkStealingPool..." << endl << endl;
+
+	ArrayOfTests tests = {testManyTasks,testForkJoin,testReuse};
+
+	for (int i = 0; i<3; i++)
+	{
+		cout << "Starting test number " << i+1 << endl;
+		if (tests[i]())
+			cout << "The test " << i+1 << " was successfully passed!" << endl;
+		else
+		{
+			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
+		cout << "==================================================" << endl << endl;
+	}
+
+	return failedTests > 0 ? 1 : 0;
+
+}
@@ -0,0 +1,78 @@
+/*
+ * bench_parallel-sort.cpp
+ *
+ * Descp: Benchmark of the multi-threaded sort (parallel-sort.h) against heap sort, sorting random points.
+ * It shows how the sort scales with the number of threads, with heap sort and radix sort for the chunks.
+ * 
+ * Usage: bench_parallel-sort [numberOfPoints] [maxThreads]
+ * 	By default, 1000000 points and the number of cores of the machine.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <stdlib.h>     /* srand, rand, atoi */
+#include "../point/Point.h"
+#include "radix-sort.h"
+#include "parallel-sort.h"
+
+using namespace std;
+
+const int REPETITIONS = 3;
+
+/**
+ * Best time, in milliseconds, of sorting a copy of input REPETITIONS times
+ */
+double timeSort(const vector<Point2f> &input, int nThreads, void (*sortChunk)(Point2f[], int))
+{
+	double best = 0;
+	for (int r = 0; r<REPETITIONS; r++)
+	{
+		vector<Point2f> toSort(input);
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		if (nThreads == 0)
+			sortChunk(toSort.data(), toSort.size());
+		else
+			parallelSort<Point2f>(toSort.data(), toSort.size(), nThreads, sortChunk);
+		double elapsed = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		if (r == 0 || elapsed < best)
+			best = elapsed;
+	}
+	return best;
+}
+
+int main(int argc, char **argv)
+{
+	int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+	int maxThreads = (argc > 2) ? atoi(argv[2]) : thread::hardware_concurrency();
+	if (maxThreads < 1)
+		maxThreads = 1;
+	
+	srand(2014);
+	vector<Point2f> input(n);
+	for (int i = 0; i<n; i++)
+		input[i] = Point2f((rand() % 2000001 - 1000000) / 100.0f, (rand() % 2000001 - 1000000) / 100.0f);
+	
+	cout << "Sorting " << n << " random points, up to " << maxThreads << " threads" << endl;
+	double heapTime = timeSort(input, 0, heapSort<Point2f>);
+	cout << "heapSort: " << fixed << setprecision(2) << heapTime << " ms" << endl << endl;
+	
+	cout << setw(8) << "threads" << setw(16) << "heap chunks" << setw(10) << "speedup"
+		<< setw(16) << "radix chunks" << setw(10) << "speedup" << endl;
+	for (int nThreads = 1; ; nThreads = min(2*nThreads, maxThreads))	//powers of 2, and maxThreads
+	{
+		double heapChunks = timeSort(input, nThreads, heapSort<Point2f>);
+		double radixChunks = timeSort(input, nThreads, radixSort);
+		cout << setw(8) << nThreads << setw(13) << heapChunks << " ms" << setw(9) << heapTime / heapChunks << "x"
+			<< setw(13) << radixChunks << " ms" << setw(9) << heapTime / radixChunks << "x" << endl;
+		
+		if (nThreads == maxThreads)
+			break;
+	}
+	
+	return 0;
+}
@@ -0,0 +1,240 @@
+/*
+ * parallel-sort.h
+ *
+ * Descp: Multi-threaded sort for any data type with the > operator defined.
+ * 
+ * 1) The array is split in nThreads chunks, and every thread sorts one of them (by heap sort
+ *    or by the sort function given).
+ * 2) The sorted chunks (runs) are merged all at once, in one pass over the data. The output is split
+ *    in nThreads pieces of the same size and, for every piece, its thread looks for the positions in all
+ *    the runs where that piece starts (binary search of the rank of every element, "multiway merge path").
+ *    Then it merges its parts of the nThreads runs with a tournament tree.
+ * 3) Every thread copies its piece of the output back to the array.
+ * The same threads do the three steps, waiting for each other between them.
+ * The merge is stable: for equal elements, the one of the run more to the left goes first.
+ * 
+ * Complexity: O((n/p) log n + p^3 log^2 n) with p threads. It needs an auxiliary buffer of n elements.
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: array of n elements, number of threads to use
+ * 
+ * Post: elements sorted, from less to most.
+ * 	formally: for (i:= 1; i<n-1)
+ * 				[i-1] <= [i] <= [i+1] 
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#ifndef parallel_sort_h
+#define parallel_sort_h
+
+#include "../heap/heap-sort.h"
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>	//std::min, std::copy
+
+//Below this number of elements per thread, threads are not worth it
+const int PARALLEL_SORT_MIN_CHUNK = 4096;
+
+/**
+ * The threads wait in it until all of them have arrived, and it can be used again after that.
+ */
+class SortBarrier
+{
+private:
+	std::mutex m_mutex;
+	std::condition_variable m_allArrived;
+	const int m_nThreads;
+	int m_waiting;
+	int m_phase;
+	
+public:
+	explicit SortBarrier(const int nThreads) : m_nThreads(nThreads), m_waiting(0), m_phase(0) {}
+	
+	void wait()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		int phase = m_phase;
+		if (++m_waiting == m_nThreads)
+		{
+			m_waiting = 0;
+			m_phase++;
+			m_allArrived.notify_all();
+		}
+		else
+			m_allArrived.wait(lock, [this, phase]() { return m_phase != phase; });
+	}
+};
+
+/**
+ * Position of the element r[i] in the merge of all the runs (r[i] is the element i of the run r).
+ * runs[q] is the first position of the run q in A, and runs[nRuns] = n.
+ * The merge is stable: for equal elements, the one of the run with less index goes first.
+ * Complexity: O(nRuns log n)
+ */
+template<typename T>
+inline int mergeRank(const T A[], const std::vector<int> &runs, const int r, const int i)
+{
+	const T &element = A[runs[r] + i];
+	int rank = i;
+	
+	for (int q = 0; q < (int) runs.size() - 1; q++)
+	{
+		if (q == r)
+			continue;
+		int low = runs[q], high = runs[q+1];
+		while (low < high)	//first element of the run q that goes after element
+		{
+			int mid = low + (high - low) / 2;
+			bool before = (q < r) ? !(A[mid] > element) : element > A[mid];
+			if (before)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+		rank += low - runs[q];
+	}
+	return rank;
+}
+
+/**
+ * For every run r, split[r] = number of its elements in the first k elements of the merge of all the runs.
+ * Complexity: O(nRuns^2 log^2 n)
+ */
+template<typename T>
+inline void mergeSplit(const T A[], const std::vector<int> &runs, const int k, std::vector<int> &split)
+{
+	int nRuns = runs.size() - 1;
+	split.resize(nRuns);
+	
+	for (int r = 0; r < nRuns; r++)
+	{
+		//The rank grows with the position inside the run
+		int low = 0, high = runs[r+1] - runs[r];
+		while (low < high)
+		{
+			int i = low + (high - low) / 2;
+			if (mergeRank(A, runs, r, i) < k)
+				low = i + 1;
+			else
+				high = i;
+		}
+		split[r] = low;
+	}
+}
+
+/**
+ * Writes in out[k1]...out[k2-1] that part of the merge of all the runs of A, in one pass.
+ */
+template<typename T>
+inline void multiwayMergePiece(const T A[], const std::vector<int> &runs, T out[], const int k1, const int k2)
+{
+	int nRuns = runs.size() - 1;
+	std::vector<int> next, end;
+	mergeSplit(A, runs, k1, next);
+	mergeSplit(A, runs, k2, end);
+	for (int r = 0; r < nRuns; r++)
+	{
+		next[r] += runs[r];
+		end[r] += runs[r];
+	}
+	
+	//Tournament tree: the leaves are the runs, every node has the run with the least next element
+	int size = 1;
+	while (size < nRuns)
+		size *= 2;
+	std::vector<int> tree(2*size, -1);
+	for (int r = 0; r < nRuns; r++)
+		if (next[r] < end[r])
+			tree[size + r] = r;
+	
+	//With equal elements the left run wins, which has less index
+	auto winner = [A, &next](int left, int right) -> int
+	{
+		if (left < 0 || right < 0)
+			return (left < 0) ? right : left;
+		return (A[next[left]] > A[next[right]]) ? right : left;
+	};
+	for (int node = size - 1; node > 0; node--)
+		tree[node] = winner(tree[2*node], tree[2*node+1]);
+	
+	for (int k = k1; k < k2; k++)
+	{
+		int best = tree[1];
+		out[k] = A[next[best]++];
+		
+		int node = size + best;
+		if (next[best] == end[best])
+			tree[node] = -1;
+		for (node /= 2; node > 0; node /= 2)
+			tree[node] = winner(tree[2*node], tree[2*node+1]);
+	}
+}
+
+/**
+ * Everything done by the thread t: sorting its chunk, merging its piece of the output in the buffer
+ * and copying that piece back, waiting for the other threads between each step.
+ */
+template<typename T>
+void parallelSortThread(T toSort[], T buffer[], const std::vector<int> &runs, void (*sortChunk)(T[], int),
+		SortBarrier &barrier, const int t)
+{
+	int first = runs[t], last = runs[t+1];
+	
+	sortChunk(toSort + first, last - first);
+	barrier.wait();
+	
+	//The pieces of the output have the same size than the chunks
+	multiwayMergePiece(toSort, runs, buffer, first, last);
+	barrier.wait();
+	
+	std::copy(buffer + first, buffer + last, toSort + first);
+}
+
+/**
+ * Sorts toSort with nThreads threads. Every chunk is sorted by sortChunk.
+ */
+template<typename T>
+void parallelSort(T toSort[], int n, int nThreads, void (*sortChunk)(T[], int))
+{
+	nThreads = std::min(nThreads, n / PARALLEL_SORT_MIN_CHUNK);
+	if (nThreads <= 1)
+	{
+		sortChunk(toSort, n);
+		return;
+	}
+	
+	std::vector<int> runs(nThreads + 1);
+	for (int t = 0; t <= nThreads; t++)
+		runs[t] = (int) ((long long) n * t / nThreads);
+	
+	std::vector<T> buffer(n);
+	SortBarrier barrier(nThreads);
+	
+	//The calling thread is the thread 0
+	std::vector<std::thread> threads;
+	threads.reserve(nThreads - 1);
+	for (int t = 1; t < nThreads; t++)
+		threads.push_back(std::thread(parallelSortThread<T>, toSort, buffer.data(), std::cref(runs), sortChunk,
+			std::ref(barrier), t));
+	parallelSortThread<T>(toSort, buffer.data(), runs, sortChunk, barrier, 0);
+	for (int t = 0; t < nThreads - 1; t++)
+		threads[t].join();
+}
+
+/**
+ * Sorts toSort with nThreads threads, sorting every chunk by heap sort.
+ */
+template<typename T>
+void parallelSort(T toSort[], int n, int nThreads)
+{
+	parallelSort<T>(toSort, n, nThreads, heapSort<T>);
+}
+
+#endif //parallel_sort_h
@@ -0,0 +1,268 @@
+/*
+ * radix-sort.h
+ *
+ * Descp: LSD radix sort for points, in ascending order of x-values and, for the same x-value,
+ * ascending order of y-values (the order given by Point2f::operator>).
+ * 
+ * Every point is mapped to an unsigned key: the high half comes from x and the low half from y. Points with
+ * float or int32_t coordinates have got 64 bits keys, and points with double or int64_t ones 128 bits keys.
+ * A float (or double) is mapped to an unsigned int which keeps its order this way:
+ * 		->positive floats: sign bit set to 1, so they are greater than every negative float.
+ * 		->negative floats: all bits flipped, so the greater the magnitude the lower the key.
+ * and a signed int just gets its sign bit flipped.
+ * The keys are sorted by digits of RADIX_BITS bits, from the least to the most significant one, and
+ * since the mapping is reversible, the points are rebuilt from the sorted keys.
+ * 
+ * Note that operator> considers two x-values equal if they are closer than an epsilon, whereas here they
+ * are compared exactly. Both orders are the same unless two x-values are that close and not equal.
+ * Also, -0 is sorted (and rebuilt) as +0.
+ * 
+ * Complexity: O(n), with 6 passes over the keys at most (12 for 128 bits keys; passes where all the keys
+ * have the same digit are skipped). It needs an auxiliary buffer of 2n keys.
+ * 
+ * radixSortIndices does not move the points: it returns the permutation of 32 bits indices which sorts them,
+ * i.e. P[perm[0]] <= P[perm[1]] <= ... It is stable, so equal points keep their relative order.
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: array of n points
+ * 
+ * Post: points sorted, from less to most.
+ * 	formally: for (i:= 1; i<n-1)
+ * 				[i-1] <= [i] <= [i+1] 
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#ifndef radix_sort_h
+#define radix_sort_h
+
+#include "../point/Point.h"
+#include <vector>
+#include <cstring>	//memcpy
+#include <algorithm>	//std::swap, std::copy
+#include <stdint.h>	//uint32_t, uint64_t
+
+const int RADIX_BITS = 11;								//2048 buckets, so the counters fit in L1 cache
+const int RADIX_BUCKETS = 1 << RADIX_BITS;
+
+/**
+ * Maps a float to an unsigned int with the same order
+ */
+inline uint32_t floatToOrderedKey(float f)
+{
+	f += 0.0f;	//-0 to +0, so both zeros get the same key
+	uint32_t u;
+	std::memcpy(&u, &f, sizeof(u));
+	uint32_t mask = -(u >> 31) | 0x80000000u;	//negative: flip all bits. positive: flip the sign bit
+	return u ^ mask;
+}
+
+/**
+ * Inverse of floatToOrderedKey
+ */
+inline float orderedKeyToFloat(uint32_t u)
+{
+	uint32_t mask = ((u >> 31) - 1) | 0x80000000u;
+	u ^= mask;
+	float f;
+	std::memcpy(&f, &u, sizeof(f));
+	return f;
+}
+
+/**
+ * Same as floatToOrderedKey, for a double
+ */
+inline uint64_t doubleToOrderedKey(double d)
+{
+	d += 0.0;
+	uint64_t u;
+	std::memcpy(&u, &d, sizeof(u));
+	uint64_t mask = -(u >> 63) | 0x8000000000000000ull;
+	return u ^ mask;
+}
+
+inline double orderedKeyToDouble(uint64_t u)
+{
+	uint64_t mask = ((u >> 63) - 1) | 0x8000000000000000ull;
+	u ^= mask;
+	double d;
+	std::memcpy(&d, &u, sizeof(d));
+	return d;
+}
+
+/**
+ * Key of the points of every coordinate type (Type), and the conversions between points and keys
+ */
+template<class T> struct PointKey;
+
+template<> struct PointKey<float>
+{
+	typedef uint64_t Type;
+	static Type of(const Point<float>& p) { return ((uint64_t) floatToOrderedKey(p.x()) << 32) | floatToOrderedKey(p.y()); }
+	static Point<float> point(Type key)
+	{
+		return Point<float>(orderedKeyToFloat((uint32_t) (key >> 32)), orderedKeyToFloat((uint32_t) key));
+	}
+};
+
+template<> struct PointKey<int32_t>
+{
+	typedef uint64_t Type;
+	static Type of(const Point<int32_t>& p)
+	{
+		return ((uint64_t) ((uint32_t) p.x() ^ 0x80000000u) << 32) | ((uint32_t) p.y() ^ 0x80000000u);
+	}
+	static Point<int32_t> point(Type key)
+	{
+		return Point<int32_t>((int32_t) ((uint32_t) (key >> 32) ^ 0x80000000u), (int32_t) ((uint32_t) key ^ 0x80000000u));
+	}
+};
+
+template<> struct PointKey<double>
+{
+	typedef uint128_t Type;
+	static Type of(const Point<double>& p) { return ((uint128_t) doubleToOrderedKey(p.x()) << 64) | doubleToOrderedKey(p.y()); }
+	static Point<double> point(Type key)
+	{
+		return Point<double>(orderedKeyToDouble((uint64_t) (key >> 64)), orderedKeyToDouble((uint64_t) key));
+	}
+};
+
+template<> struct PointKey<int64_t>
+{
+	typedef uint128_t Type;
+	static Type of(const Point<int64_t>& p)
+	{
+		return ((uint128_t) ((uint64_t) p.x() ^ 0x8000000000000000ull) << 64) | ((uint64_t) p.y() ^ 0x8000000000000000ull);
+	}
+	static Point<int64_t> point(Type key)
+	{
+		return Point<int64_t>((int64_t) ((uint64_t) (key >> 64) ^ 0x8000000000000000ull),
+			(int64_t) ((uint64_t) key ^ 0x8000000000000000ull));
+	}
+};
+
+template<class T>
+inline typename PointKey<T>::Type pointToKey(const Point<T>& p)
+{
+	return PointKey<T>::of(p);
+}
+
+template<class T>
+inline Point<T> keyToPoint(typename PointKey<T>::Type key)
+{
+	return PointKey<T>::point(key);
+}
+
+/**
+ * The digit of a key (64 or 128 bits) starting at the bit shift
+ */
+template<class Key>
+inline uint32_t radixDigit(Key key, int shift)
+{
+	return (uint32_t) (key >> shift) & (RADIX_BUCKETS-1);
+}
+
+/**
+ * Sorts n keys in ascending order. Keys are in keys[0]...keys[n-1] and buffer has room for n keys.
+ * If indices is not null, indices[i] is moved along with keys[i], using indexBuffer (room for n indices).
+ * Returns the array which ends up holding the sorted keys (either keys or buffer). The sorted indices
+ * are in the corresponding array (indices or indexBuffer).
+ */
+template<class Key>
+inline Key* radixSortKeys(Key keys[], Key buffer[], int n, uint32_t indices[] = NULL, uint32_t indexBuffer[] = NULL)
+{
+	const int RADIX_PASSES = (8*sizeof(Key) + RADIX_BITS - 1) / RADIX_BITS;
+	if (n == 0)
+		return keys;
+	
+	//One pass to count the digits for every pass
+	std::vector<uint32_t> counters(RADIX_PASSES * RADIX_BUCKETS, 0);
+	for (int i = 0; i<n; i++)
+		for (int pass = 0; pass<RADIX_PASSES; pass++)
+			++counters[pass*RADIX_BUCKETS + radixDigit(keys[i], pass*RADIX_BITS)];
+	
+	Key *from = keys, *to = buffer;
+	uint32_t *fromIndices = indices, *toIndices = indexBuffer;
+	for (int pass = 0; pass<RADIX_PASSES; pass++)
+	{
+		uint32_t *count = &counters[pass*RADIX_BUCKETS];
+		int shift = pass*RADIX_BITS;
+		
+		//If every key has the same digit, this pass would not move anything
+		if (count[radixDigit(from[0], shift)] == (uint32_t) n)
+			continue;
+		
+		//From counts to the first position of every bucket
+		uint32_t sum = 0;
+		for (int b = 0; b<RADIX_BUCKETS; b++)
+		{
+			uint32_t c = count[b];
+			count[b] = sum;
+			sum += c;
+		}
+		
+		if (indices == NULL)
+			for (int i = 0; i<n; i++)
+				to[count[radixDigit(from[i], shift)]++] = from[i];
+		else
+			for (int i = 0; i<n; i++)
+			{
+				uint32_t position = count[radixDigit(from[i], shift)]++;
+				to[position] = from[i];
+				toIndices[position] = fromIndices[i];
+			}
+		
+		std::swap(from, to);
+		std::swap(fromIndices, toIndices);
+	}
+	
+	return from;
+}
+
+template<class T>
+void radixSort(Point<T> toSort[], int n)
+{
+	typedef typename PointKey<T>::Type Key;
+	if (n < 2)
+		return;
+	
+	std::vector<Key> keys(2*n);
+	for (int i = 0; i<n; i++)
+		keys[i] = pointToKey(toSort[i]);
+	
+	Key *sorted = radixSortKeys(keys.data(), keys.data() + n, n);
+	
+	for (int i = 0; i<n; i++)
+		toSort[i] = keyToPoint<T>(sorted[i]);
+}
+
+/**
+ * Points can be any container whose operator[] gives the point i (an array of points, a PointSet...), of any
+ * coordinate type: the keys are the ones of its points (128 bits for 64 bits coordinates)
+ */
+template<class Points>
+std::vector<uint32_t> radixSortIndices(const Points &P, int n)
+{
+	typedef decltype(pointToKey(P[0])) Key;
+	std::vector<Key> keys(2*n);
+	std::vector<uint32_t> indices(2*n);
+	for (int i = 0; i<n; i++)
+	{
+		keys[i] = pointToKey(P[i]);
+		indices[i] = i;
+	}
+	
+	Key *sorted = radixSortKeys(keys.data(), keys.data() + n, n, indices.data(), indices.data() + n);
+	
+	if (sorted != keys.data())	//the sorted permutation is in the second half
+		std::copy(indices.begin() + n, indices.end(), indices.begin());
+	indices.resize(n);
+	return indices;
+}
+
+#endif //radix_sort_h
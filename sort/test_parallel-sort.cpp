@@ -0,0 +1,153 @@
+/*
+ * test_parallel-sort.cpp
+ *
+ * Descp: To test the multi-threaded sort (parallel-sort.h header)
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: some tests of sorting integers & points with different number of threads.
+ * 
+ * Post: If the tests were ok or not.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include <iostream>
+#include <stdlib.h>     /* srand, rand */
+#include <algorithm>	/* std::sort, to check the output */
+#include "../point/Point.h"
+#include "radix-sort.h"
+#include "parallel-sort.h"
+
+typedef bool (*ArrayOfTests[]) (); 
+using namespace std;
+
+/**
+ * Sorts random integers with 1 to 9 threads and compares the output with std::sort
+ */
+bool testIntegers()
+{
+	const int N = 200000;
+	vector<int> input(N);
+	for (int i = 0; i<N; i++)
+		input[i] = rand() % 1000;	//a lot of repeated values
+	vector<int> solution(input);
+	sort(solution.begin(), solution.end());
+	
+	bool equal = true;
+	for (int nThreads = 1; nThreads<10 && equal; nThreads++)
+	{
+		vector<int> toSort(input);
+		parallelSort<int>(toSort.data(), N, nThreads);
+		equal = toSort == solution;
+		cout << "Sorted with " << nThreads << " threads: " << equal << endl;
+	}
+	return equal;
+}
+
+/**
+ * Runs of different length and less elements than the threads are worth
+ */
+bool testSizes()
+{
+	int sizes[] = {0, 1, 2, PARALLEL_SORT_MIN_CHUNK - 1, 2*PARALLEL_SORT_MIN_CHUNK + 1, 3*PARALLEL_SORT_MIN_CHUNK + 17};
+	bool equal = true;
+	for (int s = 0; s<6 && equal; s++)
+	{
+		vector<int> toSort(sizes[s]);
+		for (int i = 0; i<sizes[s]; i++)
+			toSort[i] = rand();
+		vector<int> solution(toSort);
+		sort(solution.begin(), solution.end());
+		parallelSort<int>(toSort.data(), sizes[s], 4);
+		equal = toSort == solution;
+	}
+	return equal;
+}
+
+/**
+ * Sorting points with radix sort for every chunk, it has to give the same order than radix sort alone.
+ */
+bool testPoints()
+{
+	const int N = 100000;
+	vector<Point2f> toSort(N);
+	for (int i = 0; i<N; i++)
+		toSort[i] = Point2f(rand() % 500, (rand() % 2001 - 1000) / 8.0f);
+	vector<Point2f> solution(toSort);
+	radixSort(solution.data(), N);
+	parallelSort<Point2f>(toSort.data(), N, 5, radixSort);
+	
+	bool equal = true;
+	for (int i = 0; equal && i<N; i++)
+		equal = toSort[i].x() == solution[i].x() && toSort[i].y() == solution[i].y();
+	return equal;
+}
+
+/**
+ * Elements compared only by their key: the equal ones have to keep the order of the input,
+ * even when they are in different chunks
+ */
+struct KeyValue
+{
+	int key, value;
+	bool operator>(const KeyValue &other) const { return key > other.key; }
+	bool operator<(const KeyValue &other) const { return key < other.key; }
+	bool operator==(const KeyValue &other) const { return key == other.key && value == other.value; }
+};
+
+void insertionSort(KeyValue toSort[], int n)
+{
+	for (int i = 1; i<n; i++)
+		for (int j = i; j>0 && toSort[j-1] > toSort[j]; j--)
+			swap(toSort[j-1], toSort[j]);
+}
+
+bool testStability()
+{
+	const int N = 7*PARALLEL_SORT_MIN_CHUNK + 5;
+	vector<KeyValue> input(N);
+	for (int i = 0; i<N; i++)
+	{
+		input[i].key = rand() % 50;
+		input[i].value = i;
+	}
+	vector<KeyValue> solution(input);
+	stable_sort(solution.begin(), solution.end());
+	
+	bool equal = true;
+	for (int nThreads = 2; nThreads<8 && equal; nThreads++)
+	{
+		vector<KeyValue> toSort(input);
+		parallelSort<KeyValue>(toSort.data(), N, nThreads, insertionSort);
+		equal = toSort == solution;
+	}
+	return equal;
+}
+
+int main(int argc, char **argv)
+{
+	int failedTests = 0;
+	srand(2014);
+	
+	ArrayOfTests tests = {testIntegers,testSizes,testPoints,testStability};
+	const int NUM_TESTS = 4;
+	
+	for (int i = 0; i<NUM_TESTS; i++)
+	{
+		cout << "Starting test number " << i+1 << endl;
+		if (tests[i]())
+			cout << "The test " << i+1 << " was successfully passed!" << endl;
+		else
+		{
+			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
+		cout << "==================================================" << endl << endl;
+	}
+	
+	return failedTests > 0 ? 1 : 0;
+}
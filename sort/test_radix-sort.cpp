@@ -0,0 +1,177 @@
+/*
+ * test_radix-sort.cpp
+ *
+ * Descp: To test sorting points by radix sort (radix-sort.h header)
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: some tests of sorting points, comparing the output with the heap sort one.
+ * 
+ * Post: If the tests were ok or not.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include <iostream>
+#include <stdlib.h>     /* srand, rand */
+#include "../point/Point.h"
+#include "../heap/heap-sort.h"
+#include "radix-sort.h"
+
+typedef bool (*ArrayOfTests[]) (); 
+using namespace std;
+
+/**
+ * Sorts a copy of points by heap sort and other by radix sort, and compares them.
+ */
+template<class T>
+bool sameAsHeapSort(const Point<T> points[], int n)
+{
+	vector<Point<T> > byHeap(points, points + n), byRadix(points, points + n);
+	heapSort<Point<T> >(byHeap.data(), n);
+	radixSort(byRadix.data(), n);
+	
+	bool equal = true;
+	for (int i = 0; equal && i<n; i++)
+		equal = byHeap[i].x() == byRadix[i].x() && byHeap[i].y() == byRadix[i].y();
+	return equal;
+}
+
+bool testFloatKeys()
+{
+	float values[] = {-1e30f, -3.5f, -1.0f, -1e-30f, 0.0f, 1e-30f, 0.25f, 1.0f, 7.5f, 1e30f};
+	bool ordered = true;
+	for (int i = 0; i<9; i++)
+		ordered = ordered && floatToOrderedKey(values[i]) < floatToOrderedKey(values[i+1]);
+	
+	bool reversible = true;
+	for (int i = 0; i<10; i++)
+		reversible = reversible && orderedKeyToFloat(floatToOrderedKey(values[i])) == values[i];
+	
+	cout << "Keys are ordered: " << ordered << ", keys are reversible: " << reversible << endl;
+	return ordered && reversible && floatToOrderedKey(-0.0f) == floatToOrderedKey(0.0f);
+}
+
+bool testSmall()
+{
+	Point2f points[] = {Point2f(2.25,1), Point2f(1.75,0), Point2f(1,-1), Point2f(2.75,-0.75),
+		Point2f(1.25,2), Point2f(0,0), Point2f(3,0.75)};
+	return sameAsHeapSort(points, 7);
+}
+
+bool testNegativesAndSameX()
+{
+	Point2f points[] = {Point2f(-1,3), Point2f(-1,-3), Point2f(2,0), Point2f(-4.5,1), Point2f(-1,0),
+		Point2f(2,-0.5), Point2f(-0.0f,2), Point2f(0,-2)};
+	return sameAsHeapSort(points, 8);
+}
+
+bool testRandom()
+{
+	const int N = 100000;
+	vector<Point2f> points(N);
+	for (int i = 0; i<N; i++)		//distinct x-values, with random signs and magnitudes
+		points[i] = Point2f((i - N/2) * 0.37f * (1 + rand() % 7), (rand() % 2001 - 1000) / 8.0f);
+	return sameAsHeapSort(points.data(), N);
+}
+
+bool testGrid()
+{
+	const int SIDE = 300;
+	vector<Point2f> points;
+	for (int i = 0; i<SIDE*SIDE; i++)	//a lot of points sharing their x-values
+		points.push_back(Point2f(rand() % SIDE, rand() % SIDE));
+	return sameAsHeapSort(points.data(), points.size());
+}
+
+/**
+ * The permutation has to sort the points as radix sort does, and equal points must keep their order
+ */
+template<class T>
+bool sameIndices(const vector<Point<T> > &points)
+{
+	int N = points.size();
+	vector<Point<T> > solution(points);
+	radixSort(solution.data(), N);
+	
+	vector<uint32_t> perm = radixSortIndices(points.data(), N);
+	bool equal = perm.size() == (unsigned int) N;
+	for (int i = 0; equal && i<N; i++)
+		equal = points[perm[i]].x() == solution[i].x() && points[perm[i]].y() == solution[i].y()
+			&& (i == 0 || points[perm[i-1]].x() != points[perm[i]].x() || points[perm[i-1]].y() != points[perm[i]].y()
+				|| perm[i-1] < perm[i]);
+	return equal && radixSortIndices(points.data(), 0).empty();
+}
+
+/**
+ * A lot of repeated points, with the 4 coordinate types (the keys of double and int64_t points are of
+ * 128 bits: the x-value is in the high half)
+ */
+bool testIndices()
+{
+	const int N = 50000;
+	vector<Point2f> points(N);
+	vector<Point2d> pointsDouble(N);
+	vector<Point2i> pointsInt(N);
+	vector<Point2l> pointsLong(N);
+	for (int i = 0; i<N; i++)
+	{
+		int x = rand() % 100 - 50, y = rand() % 100 - 50;
+		points[i] = Point2f(x, y);
+		pointsDouble[i] = Point2d(x + 0.25, y * 1e-3);
+		pointsInt[i] = Point2i(x, y);
+		pointsLong[i] = Point2l((int64_t) x << 40, y);
+	}
+	return sameIndices(points) && sameIndices(pointsDouble) && sameIndices(pointsInt) && sameIndices(pointsLong);
+}
+
+/**
+ * Points with double, int32_t and int64_t coordinates (128 bits keys for the 64 bits ones), with
+ * negative values, big magnitudes and repeated x-values
+ */
+bool testCoordinateTypes()
+{
+	const int N = 20000;
+	vector<Point2d> doubles(N);
+	vector<Point2i> ints(N);
+	vector<Point2l> longs(N);
+	for (int i = 0; i<N; i++)
+	{
+		int x = rand() % 2001 - 1000, y = rand() % 2001 - 1000;
+		doubles[i] = Point2d(x * 1.5e200, y * -0.001);
+		ints[i] = Point2i(x * 2147483, y == 0 ? INT32_MIN : y * 2147483);
+		longs[i] = Point2l(x * 9223372036854775LL, y == 0 ? INT64_MAX : y);
+	}
+	
+	bool equal = sameAsHeapSort(doubles.data(), N) && sameAsHeapSort(ints.data(), N) && sameAsHeapSort(longs.data(), N);
+	cout << "Same order than heap sort for double, int32_t and int64_t: " << equal << endl;
+	return equal && doubleToOrderedKey(-0.0) == doubleToOrderedKey(0.0) && orderedKeyToDouble(doubleToOrderedKey(-2.5)) == -2.5;
+}
+
+int main(int argc, char **argv)
+{
+	int failedTests = 0;
+	srand(2014);
+	
+	ArrayOfTests tests = {testFloatKeys,testSmall,testNegativesAndSameX,testRandom,testGrid,testIndices,
+		testCoordinateTypes};
+	const int NUM_TESTS = 7;
+	
+	for (int i = 0; i<NUM_TESTS; i++)
+	{
+		cout << "Starting test number " << i+1 << endl;
+		if (tests[i]())
+			cout << "The test " << i+1 << " was successfully passed!" << endl;
+		else
+		{
+			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
+		cout << "==================================================" << endl << endl;
+	}
+	
+	return failedTests > 0 ? 1 : 0;
+}
@@ -21,7 +21,7 @@
 #include <string>       // std::string
 #include <iostream>     // std::cout
 #include <sstream>      // std::ostringstream
-#include "CH_Algorithms.cpp"
+#include "CH_Algorithms.h"
 #include <vector>
 #include <deque>
 
@@ -234,6 +234,173 @@ bool test_iterative_hull_unsorted()
 	
 	return (expected_output == vector_output);
 }
+
+/**
+ * Same points than test_iterative_hull_unsorted, but getting the indices of the convex hull vertices.
+ * The input points must not be moved.
+ */
+bool test_iterative_hull_indices()
+{
+	Point2f p1(0,0);
+	Point2f p2(1,-1);
+	Point2f p3(1.25,2);
+	Point2f p4(1.75,0);
+	Point2f p5(2.25,1);
+	Point2f p6(2.75,-0.75);
+	Point2f p7(3,0.75);
+	const Point2f obstacle[] = {p5,p4,p2,p6,p3,p1,p7};
+	vector<uint32_t> vector_output = IterativeConvexHullIndices (obstacle, 7);
+	
+	cout << "The algorithm output was -> ";
+	for (unsigned int i = 0; i < vector_output.size(); i++)
+		cout << vector_output[i] << ", ";
+	cout << endl;
+	
+	uint32_t expected[] = {5,4,6,3,2}; //p1,p3,p7,p6,p2
+	vector<uint32_t> expected_output(expected, expected + 5);
+	bool passed = (expected_output == vector_output) && obstacle[0] == p5 && obstacle[5] == p1;
+	
+	//The permutation of double points (128 bits keys) by heap sort and by radix sort: sorted by x-value first
+	int sizes[] = {100, RADIX_SORT_MIN_POINTS + 100};
+	for (int s = 0; s < 2 && passed; s++)
+	{
+		vector<Point2d> points(sizes[s]);
+		for (int i = 0; i < sizes[s]; i++)
+			points[i] = Point2d(rand() % 20 - 10.5, rand() % 1000);
+		vector<uint32_t> perm = sortIndices(points.data(), sizes[s]);
+		for (int i = 1; i < sizes[s] && passed; i++)
+			passed = pointToKey(points[perm[i-1]]) <= pointToKey(points[perm[i]]);
+	}
+	return passed;
+}
+
+/**
+ * Same points than test_iterative_hull_sorted2, stored as columns in a PointSet.
+ */
+bool test_iterative_hull_pointset()
+{
+	float xs[] = {2,-1.4,-1,-0.5,1.85,-0.4,-0.23,0.33333,0.95,1,1.43,1.8,-1.4,-4,4};
+	float ys[] = {2,0.9,2,0.7,-2,-1.2,1.45,0.487,-1,2,0.3,1.45,-0.2,-3,3};
+	PointSet obstacle(xs, ys, 15);
+	vector<Point2f> vector_output = IterativeConvexHull (obstacle);
+	cout << "The algorithm output was -> ";
+	printVector2(vector_output);
+	
+	vector<Point2f> expected_output;
+	expected_output.push_back(Point2f(-4,-3));
+	expected_output.push_back(Point2f(-1,2));
+	expected_output.push_back(Point2f(4,3));
+	expected_output.push_back(Point2f(1.85,-2));
+	cout << "The expect output was -> ";
+	printVector2(expected_output);
+	
+	return (expected_output == vector_output);
+}
+
+/**
+ * A square with N-4 points inside. Only the corners of the square belong to the convex hull.
+ */
+bool iterative_hull_square(const int N, const HullOptions &options)
+{
+	Point2f p1(0,0);
+	Point2f p2(0,100);
+	Point2f p3(100,100);
+	Point2f p4(100,0);
+	vector<Point2f> obstacle;
+	for (int i = 0; i<N; i++)
+		obstacle.push_back(Point2f(1 + (rand() % 9800) / 100.0f, 1 + (rand() % 9800) / 100.0f));
+	obstacle[N/4] = p3;
+	obstacle[N/3] = p1;
+	obstacle[N/2] = p4;
+	obstacle[N-1] = p2;
+	
+	vector<Point2f> vector_output;
+	vector_output = IterativeConvexHull (obstacle.data(), N, options);
+	cout << "The algorithm output was -> ";
+	printVector2(vector_output);
+	
+	vector<Point2f> expected_output;
+	expected_output.push_back(p1);
+	expected_output.push_back(p2);
+	expected_output.push_back(p3);
+	expected_output.push_back(p4);
+	cout << "The expect output was -> ";
+	printVector2(expected_output);
+	
+	return (expected_output == vector_output);
+}
+
+/**
+ * More points than the ones sorted by heap sort.
+ */
+bool test_iterative_hull_big()
+{
+	return iterative_hull_square(5000, HullOptions());
+}
+
+/**
+ * Sorting the points with several threads.
+ */
+bool test_iterative_hull_threads()
+{
+	HullOptions options;
+	options.sortThreads = 4;
+	return iterative_hull_square(50000, options);
+}
+
+/**
+ * With the prefilter, all the points inside the square are discarded before sorting.
+ */
+bool test_iterative_hull_prefilter()
+{
+	const int N = 20000;
+	HullStats stats;
+	HullOptions options;
+	options.prefilter = true;
+	options.stats = &stats;
+	
+	bool passed = true;
+	for (int nExtremes = 4; nExtremes <= 8 && passed; nExtremes += 4)
+	{
+		options.prefilterExtremes = nExtremes;
+		passed = iterative_hull_square(N, options);
+		cout << "Points culled with " << nExtremes << " extreme points: " << stats.culledPoints << endl;
+		passed = passed && stats.culledPoints == N-4;
+	}
+	return passed;
+}
+
+/**
+ * The hull written on a caller buffer must be the same than the one built with the deques of
+ * UpperHull and LowerHull.
+ */
+bool test_iterative_hull_buffer()
+{
+	const int N = 2000;
+	vector<Point2f> obstacle;
+	for (int i = 0; i<N; i++)
+		obstacle.push_back(Point2f((rand() % 100000) / 100.0f, (rand() % 100000) / 100.0f));
+	
+	sortPoints(obstacle.data(), N);
+	deque<Point2f> upper = UpperHull(obstacle.data(), N);
+	deque<Point2f> lower = LowerHull(obstacle.data(), N);
+	vector<Point2f> expected_output(upper.begin(), upper.end());
+	expected_output.insert(expected_output.end(), lower.begin()+1, lower.end()-1);
+	
+	random_shuffle(obstacle.begin(), obstacle.end());
+	vector<Point2f> hull(N+1);
+	int h = IterativeConvexHull(obstacle.data(), N, hull.data());
+	cout << "Convex hull with " << h << " vertices, expected " << expected_output.size() << endl;
+	
+	bool passed = h == (int) expected_output.size();
+	for (int i = 0; i < h && passed; i++)
+		passed = hull[i].x() == expected_output[i].x() && hull[i].y() == expected_output[i].y();
+	
+	//Less than three points are just copied
+	Point2f two[] = {Point2f(1,1), Point2f(0,0)};
+	h = IterativeConvexHull(two, 2, hull.data());
+	return passed && h == 2 && hull[0].x() == 0 && hull[1].x() == 1;
+}
 #endif
 
 #ifdef TEST_DIVIDE_CONQUEST
@@ -359,20 +526,499 @@ bool test_dc_4 () //hard one. 15 points. unsorted.
 	return (expected_output == vector_output);
 }
 
+/**
+ * Equivalent to test_dc_4, discarding the points inside the extreme points polygon before.
+ */
+bool test_dc_prefilter ()
+{
+	Point2f p1(-4,-3);
+	Point2f p2(-1.4,0.9);
+	Point2f p3(-1.4,-0.2);
+	Point2f p4(-1,2);
+	Point2f p5(-0.5,0.7);
+	Point2f p6(-0.4,-1.2);
+	Point2f p7(-0.23,1.45);
+	Point2f p8(0.33333,0.487);
+	Point2f p9(0.95,-1);
+	Point2f p10(1,2);
+	Point2f p11(1.43,0.3);
+	Point2f p12(1.8,1.45);
+	Point2f p13(1.85,-2);
+	Point2f p14(2,2);
+	Point2f p15(4,3);
+	
+	Point2f obstacle[] = {p12,p5,p15,p4,p8,p6,p7,p2,p9,p1,p11,p10,p13,p14,p3};
+	HullStats stats;
+	HullOptions options;
+	options.prefilter = true;
+	options.stats = &stats;
+	vector<Point2f> vector_output;
+	vector_output = DivideAndConquestConvexHull (obstacle, 15, options);
+	cout << "The algorithm output was -> ";
+	printVector2(vector_output);
+	cout << "Points culled: " << stats.culledPoints << endl;
+	
+	vector<Point2f> expected_output;
+	expected_output.push_back(p1);
+	expected_output.push_back(p4);
+	expected_output.push_back(p15);
+	expected_output.push_back(p13);
+	cout << "The expect output was -> ";
+	printVector2(expected_output);
+	return (expected_output == vector_output) && stats.culledPoints > 0;
+}
+
+/**
+ * Indices of the hulls of random points with many repeated ones, for every coordinate type: they have to be
+ * the ones of the first repeated point of every vertex, with the same vertices than the hulls of the points.
+ */
+template<class T>
+bool sameHullIndices (const vector<Point2f> &input)
+{
+	int n = input.size();
+	vector<Point<T> > points(n);
+	for (int i = 0; i < n; i++)	//*3 and +0.5, so the doubles have got more precision than the floats
+		points[i] = Point<T>((T) (input[i].x() * 3) + (T) 0.5, (T) (input[i].y() * 3));
+	
+	vector<Point<T> > copy(points);
+	vector<Point<T> > hull = DivideAndConquestConvexHull (copy.data(), n);
+	vector<uint32_t> dc = DivideAndConquestConvexHullIndices (points.data(), n);
+	copy = points;
+	vector<Point<T> > iterativeHull = IterativeConvexHull (copy.data(), n);
+	vector<uint32_t> iterative = IterativeConvexHullIndices (points.data(), n);
+	
+	bool passed = dc.size() == hull.size() && iterative.size() == iterativeHull.size();
+	for (unsigned int i = 0; i < dc.size() && passed; i++)
+		passed = points[dc[i]] == hull[i]
+			&& std::find(points.begin(), points.end(), hull[i]) - points.begin() == (int) dc[i];
+	for (unsigned int i = 0; i < iterative.size() && passed; i++)
+		passed = points[iterative[i]] == iterativeHull[i];
+	return passed;
+}
+
+/**
+ * Equivalent to test_dc_4, but getting the indices of the convex hull vertices.
+ */
+bool test_dc_indices ()
+{
+	Point2f p1(-4,-3);
+	Point2f p2(-1.4,0.9);
+	Point2f p3(-1.4,-0.2);
+	Point2f p4(-1,2);
+	Point2f p5(-0.5,0.7);
+	Point2f p6(-0.4,-1.2);
+	Point2f p7(-0.23,1.45);
+	Point2f p8(0.33333,0.487);
+	Point2f p9(0.95,-1);
+	Point2f p10(1,2);
+	Point2f p11(1.43,0.3);
+	Point2f p12(1.8,1.45);
+	Point2f p13(1.85,-2);
+	Point2f p14(2,2);
+	Point2f p15(4,3);
+	
+	const Point2f obstacle[] = {p12,p5,p15,p4,p8,p6,p7,p2,p9,p1,p11,p10,p13,p14,p3};
+	vector<uint32_t> vector_output = DivideAndConquestConvexHullIndices (obstacle, 15);
+	
+	cout << "The algorithm output was -> ";
+	for (unsigned int i = 0; i < vector_output.size(); i++)
+		cout << vector_output[i] << ", ";
+	cout << endl;
+	
+	uint32_t expected[] = {9,3,2,12}; //p1,p4,p15,p13
+	vector<uint32_t> expected_output(expected, expected + 4);
+	bool passed = (expected_output == vector_output) && obstacle[0] == p12;
+	
+	//Many repeated points: the indices are the ones of the first repeated point, with the same vertices than
+	//DivideAndConquestConvexHull, and the points are not moved
+	const int N = 3000;
+	vector<Point2f> points;
+	while (points.size() < N)	//in a circle, so the hull has got more than 4 vertices
+	{
+		int x = rand() % 41 - 20, y = rand() % 41 - 20;
+		if (x*x + y*y <= 400)
+			points.push_back(Point2f(x, y));
+	}
+	vector<Point2f> copy(points);
+	vector<Point2f> hull = DivideAndConquestConvexHull (copy.data(), N);
+	vector_output = DivideAndConquestConvexHullIndices (points.data(), N);
+	passed = passed && vector_output.size() == hull.size();
+	for (unsigned int i = 0; i < vector_output.size() && passed; i++)
+		passed = points[vector_output[i]] == hull[i]
+			&& std::find(points.begin(), points.end(), hull[i]) - points.begin() == (int) vector_output[i];
+	cout << "Hull of " << vector_output.size() << " indices of " << N << " points" << endl;
+	
+	passed = passed && sameHullIndices<double>(points) && sameHullIndices<int32_t>(points)
+		&& sameHullIndices<int64_t>(points);
+	PointSet columns(points.data(), N);
+	passed = passed && DivideAndConquestConvexHullIndices (columns) == vector_output;
+	cout << "Same indices for double, int32_t, int64_t and PointSet points: " << passed << endl;
+	return passed;
+}
+
+/**
+ * Random points (with different x-values), the D&C hull must be the same than the iterative one.
+ */
+bool test_dc_random ()
+{
+	const int N = 20000;
+	vector<Point2f> obstacle;
+	for (int i = 0; i<N; i++)
+		obstacle.push_back(Point2f(i / 10.0f, (rand() % 100000) / 100.0f));
+	random_shuffle(obstacle.begin(), obstacle.end());
+	vector<Point2f> copy(obstacle);
+	
+	vector<Point2f> vector_output = DivideAndConquestConvexHull (obstacle.data(), N);
+	vector<Point2f> expected_output = IterativeConvexHull (copy.data(), N);
+	cout << "D&C hull with " << vector_output.size() << " vertices, iterative hull with " 
+		<< expected_output.size() << endl;
+	
+	return (expected_output == vector_output);
+}
+
+/**
+ * Parallel recursion, with several threads and grain sizes. The hull must be the same than the iterative one.
+ */
+bool test_dc_threads ()
+{
+	const int N = 200000;
+	vector<Point2f> obstacle;
+	for (int i = 0; i<N; i++)
+		obstacle.push_back(Point2f((rand() % 1000000) / 100.0f, (rand() % 1000000) / 100.0f));
+	vector<Point2f> copy(obstacle);
+	vector<Point2f> expected_output = IterativeConvexHull (copy.data(), N);
+	
+	bool passed = true;
+	HullOptions options;
+	for (options.dcThreads = 2; options.dcThreads <= 8 && passed; options.dcThreads *= 2)
+		for (options.dcGrain = 100; options.dcGrain <= 100000 && passed; options.dcGrain *= 10)
+		{
+			copy = obstacle;
+			vector<Point2f> vector_output = DivideAndConquestConvexHull (copy.data(), N, options);
+			cout << "D&C with " << options.dcThreads << " threads and grain " << options.dcGrain << ": "
+				<< vector_output.size() << " vertices" << endl;
+			passed = (expected_output == vector_output);
+		}
+	
+	//The same pool for several hulls, without dcThreads
+	WorkStealingPool pool(4);
+	options = HullOptions();
+	options.dcPool = &pool;
+	options.dcGrain = 1000;
+	for (int i = 0; i<3 && passed; i++)
+	{
+		copy = obstacle;
+		passed = (expected_output == DivideAndConquestConvexHull (copy.data(), N, options));
+	}
+	cout << "D&C on a pool given in the options: " << passed << endl;
+	return passed;
+}
+
+/**
+ * The same random points solved with different cutoffs (from always splitting to pure monotone chain).
+ */
+bool test_dc_cutoff ()
+{
+	const int N = 5000;
+	vector<Point2f> obstacle;
+	for (int i = 0; i<N; i++)
+		obstacle.push_back(Point2f((rand() % 100000) / 100.0f, (rand() % 100000) / 100.0f));
+	vector<Point2f> copy(obstacle);
+	vector<Point2f> expected_output = IterativeConvexHull (copy.data(), N);
+	
+	int cutoffs[] = {3, 4, 5, 17, 64, 1000, N};
+	bool passed = true;
+	HullOptions options;
+	for (int c = 0; c < 7 && passed; c++)
+	{
+		options.dcCutoff = cutoffs[c];
+		copy = obstacle;
+		vector<Point2f> vector_output = DivideAndConquestConvexHull (copy.data(), N, options);
+		cout << "D&C with cutoff " << options.dcCutoff << ": " << vector_output.size() << " vertices" << endl;
+		passed = (expected_output == vector_output);
+	}
+	return passed;
+}
+
+/**
+ * Points on a grid: many points with the same x-value (vertical tangent lines) and repeated points.
+ */
+bool test_dc_grid ()
+{
+	const int N = 3000;
+	bool passed = true;
+	HullOptions options;
+	options.dcGrain = 100;
+	for (int gridSize = 2; gridSize <= 512 && passed; gridSize *= 4)
+	{
+		vector<Point2f> obstacle;
+		for (int i = 0; i<N; i++)
+			obstacle.push_back(Point2f(rand() % gridSize, rand() % gridSize));
+		vector<Point2f> copy(obstacle);
+		vector<Point2f> expected_output = IterativeConvexHull (copy.data(), N);
+		
+		for (options.dcCutoff = 3; options.dcCutoff <= 48 && passed; options.dcCutoff *= 4)
+			for (options.dcThreads = 1; options.dcThreads <= 2 && passed; options.dcThreads++)
+			{
+				copy = obstacle;
+				vector<Point2f> vector_output = DivideAndConquestConvexHull (copy.data(), N, options);
+				passed = (expected_output == vector_output);
+			}
+		cout << "Grid of " << gridSize << "x" << gridSize << ": " << expected_output.size() << " vertices, "
+			<< (passed ? "same" : "different") << " output" << endl;
+	}
+	return passed;
+}
+
+/**
+ * Degenerate sets: all the points in a vertical line, and the same point repeated.
+ */
+bool test_dc_degenerate ()
+{
+	vector<Point2f> line;
+	for (int i = 0; i<100; i++)
+		line.push_back(Point2f(2, (i * 37) % 100));
+	vector<Point2f> vector_output = DivideAndConquestConvexHull (line.data(), 100);
+	cout << "The algorithm output was -> ";
+	printVector2(vector_output);
+	bool passed = vector_output.size() == 2 && vector_output[0].y() == 0 && vector_output[1].y() == 99;
+	
+	vector<Point2f> same(10, Point2f(1.5f, -2));
+	vector<Point2f> copy(same);
+	vector_output = DivideAndConquestConvexHull (same.data(), 10);
+	vector<Point2f> iterative_output = IterativeConvexHull (copy.data(), 10);
+	cout << "The algorithm output was -> ";
+	printVector2(vector_output);
+	return passed && vector_output.size() == 1 && iterative_output.size() == 1 && vector_output[0].x() == 1.5f;
+}
+
 #endif
 
+/**
+ * Checks, by exact orientation tests, that hull is a convex polygon in clockwise order (without
+ * collinear vertices) and that no point of P is outside it. Complexity: O(n*h)
+ */
+template<class T>
+bool isExactHull(const vector<Point<T> > &hull, const vector<Point<T> > &P)
+{
+	int h = hull.size();
+	bool convex = h >= 3;
+	for (int i = 0; i<h && convex; i++)
+	{
+		convex = turnExact(hull[i], hull[(i+1)%h], hull[(i+2)%h]) < 0;
+		for (unsigned int j = 0; j<P.size() && convex; j++)
+			convex = turnExact(hull[i], hull[(i+1)%h], P[j]) <= 0;
+	}
+	return convex;
+}
+
+/**
+ * Points where turn() is wrong: in a tiny square (every cross product is lower than its epsilon) and
+ * almost in a line with big coordinates. With exactOrientation both algorithms must give the exact convex hull.
+ */
+bool test_dc_exact ()
+{
+	vector<Point2f> tiny(2000), line(2000);
+	for (unsigned int i = 0; i<tiny.size(); i++)
+	{
+		tiny[i] = Point2f((rand() % 10001) * 1e-8f, (rand() % 10001) * 1e-8f);
+		int t = rand() % 4000000;
+		line[i] = Point2f(t, t + (rand() % 3 - 1));
+	}
+	
+	bool passed = true;
+	const vector<Point2f>* sets[] = {&tiny, &line};
+	for (int set = 0; set<2 && passed; set++)
+		for (int variant = 0; variant<3 && passed; variant++)
+		{
+			HullStats statsDc, statsIt;
+			HullOptions options;
+			options.exactOrientation = true;
+			options.prefilter = variant == 1;
+			options.dcThreads = (variant == 2) ? 4 : 1;
+			options.dcGrain = 100;
+			
+			vector<Point2f> copyDc(*sets[set]), copyIt(*sets[set]);
+			options.stats = &statsDc;
+			vector<Point2f> dc = DivideAndConquestConvexHull(copyDc.data(), copyDc.size(), options);
+			options.stats = &statsIt;
+			vector<Point2f> iterative = IterativeConvexHull(copyIt.data(), copyIt.size(), options);
+			
+			cout << "Hull of " << dc.size() << " points (" << iterative.size() << " iterative), calls to turnExact: "
+				<< statsDc.exactTurns << " (" << statsIt.exactTurns << " iterative)" << endl;
+			passed = dc == iterative && isExactHull(dc, *sets[set]);
+			if (set == 1)	//almost collinear points need the slow path
+				passed = passed && statsDc.exactTurns > 0 && statsIt.exactTurns > 0;
+		}
+	
+	//Without exact tests, the tiny square is almost a straight line
+	vector<Point2f> copyDc(tiny), copyIt(tiny);
+	return passed && !isExactHull(DivideAndConquestConvexHull(copyDc.data(), copyDc.size()), tiny)
+		&& !isExactHull(IterativeConvexHull(copyIt.data(), copyIt.size()), tiny);
+}
+
+/**
+ * Float points almost collinear for turn() (a grid of 0.1 spacing rotated 45 degrees, and points almost in a
+ * line), always split (cutoff 3): the tangent points of some merges are wrong or never found with the
+ * tolerance of turn(), so they are searched with exact tests. The hull must be found, with every point
+ * inside it (within the tolerance), and with exactOrientation it must be the same than the iterative one.
+ */
+bool test_dc_float_grid ()
+{
+	vector<Point2f> grid, line;
+	for (int i = 0; i<10; i++)
+		for (int j = 0; j<13; j++)
+			grid.push_back(Point2f(i*0.1f + j*0.1f, j*0.1f - i*0.1f));
+	for (int t = 0; t<149; t++)
+		line.push_back(Point2f(t * 1000.0f, t * 777.0f + (rand() % 2) * 1e-5f));
+	
+	bool passed = true;
+	const vector<Point2f>* sets[] = {&grid, &line};
+	for (int set = 0; set<2 && passed; set++)
+		for (int variant = 0; variant<4 && passed; variant++)
+		{
+			HullOptions options;
+			options.dcCutoff = 3;
+			options.dcGrain = 16;
+			options.dcThreads = (variant % 2 == 0) ? 1 : 2;
+			options.exactOrientation = variant >= 2;
+			HullStats stats;
+			options.stats = &stats;
+			vector<Point2f> copyDc(*sets[set]), copyIt(*sets[set]);
+			vector<Point2f> dc = DivideAndConquestConvexHull(copyDc.data(), copyDc.size(), options);
+			
+			int h = dc.size();
+			passed = h >= 2 && (!options.exactOrientation || dc == IterativeConvexHull(copyIt.data(), copyIt.size(), options));
+			for (int i = 0; i<h && passed; i++)
+				for (unsigned int j = 0; j<sets[set]->size() && passed; j++)
+					passed = turn(dc[i], dc[(i+1)%h], (*sets[set])[j]) <= 0;
+			//The tangent lines are found by exact tests even for these sets, so no merge is done by monotone chain
+			passed = passed && stats.dcFallbackMerges == 0;
+			cout << "Hull of " << dc.size() << " points with " << options.dcThreads << " threads"
+				<< (options.exactOrientation ? " and exact tests" : "") << ", merges by monotone chain: "
+				<< stats.dcFallbackMerges << endl;
+		}
+	return passed;
+}
+
+/**
+ * Converts the points to coordinate type T, multiplied by scale
+ */
+template<class T>
+vector<Point<T> > convertPoints(const vector<Point2i> &P, T scale)
+{
+	vector<Point<T> > converted(P.size());
+	for (unsigned int i = 0; i<P.size(); i++)
+		converted[i] = Point<T>(P[i].x() * scale, P[i].y() * scale);
+	return converted;
+}
+
+/**
+ * Hull of P by both algorithms (with exact orientation tests, 2 threads and small grain and cutoff),
+ * which must be the same exact convex hull
+ */
+template<class T>
+vector<Point<T> > exactHull(const vector<Point<T> > &P, bool &passed)
+{
+	HullOptions options;
+	options.exactOrientation = true;
+	options.dcThreads = 2;
+	options.dcGrain = 500;
+	options.dcCutoff = 16;
+	options.prefilter = true;
+	vector<Point<T> > copyDc(P), copyIt(P);
+	vector<Point<T> > dc = DivideAndConquestConvexHull(copyDc.data(), copyDc.size(), options);
+	passed = passed && dc == IterativeConvexHull(copyIt.data(), copyIt.size(), options) && isExactHull(dc, P);
+	return dc;
+}
+
+/**
+ * The merge by monotone chain, used when the tangent lines aren't found: it has to give the hull of both
+ * sub-hulls and be counted in HullStats::dcFallbackMerges.
+ */
+bool test_dc_fallback_merge ()
+{
+	vector<Point2f> left, right;
+	for (int i = 0; i<300; i++)
+	{
+		left.push_back(Point2f((rand() % 1000) / 100.0f, (rand() % 2000 - 1000) / 100.0f));
+		right.push_back(Point2f(10.5f + (rand() % 1000) / 100.0f, (rand() % 2000 - 1000) / 100.0f));
+	}
+	vector<Point2f> hullA = IterativeConvexHull (left.data(), left.size());
+	vector<Point2f> hullB = IterativeConvexHull (right.data(), right.size());
+	int sizeA = hullA.size(), sizeB = hullB.size();
+	
+	//Both sub-hulls one after another, as in the recursion (subSetA has room for both)
+	vector<Point2f> set(hullA);
+	set.insert(set.end(), hullB.begin(), hullB.end());
+	vector<Point2f> mergeSet(sizeA + sizeB);
+	std::atomic<int> fallbackMerges(0);
+	int indexRightMost;
+	int mergeSize = mergeByMonotoneChain(set.data(), sizeA, set.data() + sizeA, sizeB, mergeSet.data(), indexRightMost,
+		DAndCOrientation<EpsilonOrientation>(EpsilonOrientation(), &fallbackMerges));
+	mergeSet.resize(mergeSize);
+	
+	vector<Point2f> all(left);
+	all.insert(all.end(), right.begin(), right.end());
+	vector<Point2f> expected_output = IterativeConvexHull (all.data(), all.size());
+	
+	int rightMost = 0;
+	for (int i = 1; i<mergeSize; i++)
+		if (mergeSet[i].x() > mergeSet[rightMost].x())
+			rightMost = i;
+	cout << "Merged by monotone chain: " << mergeSize << " vertices, counted merges: " << fallbackMerges.load() << endl;
+	return mergeSet == expected_output && indexRightMost == rightMost && fallbackMerges.load() == 1;
+}
+
+/**
+ * The same points (almost on the edges of a triangle, with integer coordinates) with the 4 coordinate types.
+ * Integers are exact with int32_t and int64_t coordinates up to their maxCoordinate.
+ */
+bool test_dc_coordinate_types ()
+{
+	const int N = 5000;
+	const int32_t SMALL = 1 << 22;	//exact as floats
+	const int32_t MAXIMUMS[] = {SMALL, CoordinateTraits<int32_t>::maxCoordinate};
+	bool passed = true;
+	for (int m = 0; m<2 && passed; m++)
+	{
+		int32_t max = MAXIMUMS[m];
+		Point2i corners[3] = {Point2i(-max, -max), Point2i(max, 0), Point2i(0, max)};
+		vector<Point2i> points(N);
+		for (int i = 0; i<N; i++)
+		{
+			const Point2i &a = corners[i % 3], &b = corners[(i+1) % 3];
+			double t = (rand() % 100000) / 100000.0;
+			points[i] = Point2i((int32_t) (a.x() + (b.x() - (double) a.x()) * t), (int32_t) (a.y() + (b.y() - (double) a.y()) * t));
+			points[i].x(std::max(-max, std::min(max, points[i].x() - rand() % 2)));
+		}
+		
+		vector<Point2i> hull = exactHull(points, passed);
+		vector<Point2l> hullLong = exactHull(convertPoints<int64_t>(points, (int64_t) 1 << 31), passed);
+		vector<Point2d> hullDouble = exactHull(convertPoints<double>(points, 0.5), passed);
+		passed = passed && hullLong == convertPoints<int64_t>(hull, (int64_t) 1 << 31) && hullDouble == convertPoints<double>(hull, 0.5);
+		if (max == SMALL)
+			passed = passed && exactHull(convertPoints<float>(points, 1.0f), passed) == convertPoints<float>(hull, 1.0f);
+		cout << "Convex hull of " << hull.size() << " vertices with coordinates up to " << max << endl;
+	}
+	return passed;
+}
+
 int main(int argc, char **argv)
 {
+	int failedTests = 0;
 
 #ifdef TEST_ITERATIVE
 	cout << "Testing iterative Convex hull algorithms..." << endl << endl;
 	
 	ArrayOfTests tests = {test_print_deque,test_iterative_upper,test_iterative_lower,
-		test_iterative_hull_sorted,test_iterative_hull_sorted2,test_iterative_hull_unsorted}; 
+		test_iterative_hull_sorted,test_iterative_hull_sorted2,test_iterative_hull_unsorted,test_iterative_hull_big,
+		test_iterative_hull_threads,test_iterative_hull_indices,test_iterative_hull_pointset,
+		test_iterative_hull_prefilter,test_iterative_hull_buffer}; 
 	/* No need to put &test1 since the standard says 
 	that a function name in this context is converted to the address of the function */
 
-	const int NUM_TEST_IT = 6;
+	const int NUM_TEST_IT = 12;
 	
 	for (int i = 0; i<NUM_TEST_IT; i++)
 	{
@@ -380,7 +1026,10 @@ int main(int argc, char **argv)
 		if (tests[i]())
 			cout << "The test " << i+1 << " was successfully passed!" << endl;
 		else
+		{
 			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
 		cout << "==================================================" << endl << endl;
 	}
 #endif
@@ -388,9 +1037,12 @@ int main(int argc, char **argv)
 #ifdef TEST_DIVIDE_CONQUEST
 	cout << "Testing D&C Convex hull algorithms..." << endl << endl;
 	
-	ArrayOfTests test_dc = {test_dc_1,test_dc_2,test_dc_3,test_dc_4};
+	ArrayOfTests test_dc = {test_dc_1,test_dc_2,test_dc_3,test_dc_4,test_dc_indices,test_dc_prefilter,
+		test_dc_random,test_dc_threads,
+		test_dc_cutoff,test_dc_grid,test_dc_degenerate,test_dc_exact,test_dc_float_grid,test_dc_fallback_merge,
+		test_dc_coordinate_types};
 
-	const int NUM_TEST_RE = 4;
+	const int NUM_TEST_RE = 15;
 	
 	for (int i = 0; i<NUM_TEST_RE; i++)
 	{
@@ -398,12 +1050,15 @@ int main(int argc, char **argv)
 		if (test_dc[i]())
 			cout << "The test " << i+1 << " was successfully passed!" << endl;
 		else
+		{
 			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
 		cout << "==================================================" << endl << endl;
 	}
 #endif
 	
-	return 0;
+	return failedTests > 0 ? 1 : 0;
 }
 
 
@@ -0,0 +1,120 @@
+/*
+ * test_header_only.cpp
+ *
+ * Descp: 
+ *  Executable for testing that the library headers can be included by several translation units
+ *  (see test_header_only_unit.cpp) of the same program, and that both units share the same state.
+ *
+ ******************************************************************************
+ *
+ ******************************************************************************
+ * Pre: 
+ * 		<some tests
+ *
+ * Post:
+ * 		>If the tests were ok or not
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include <iostream>     // std::cout
+#include <vector>
+#include <stdlib.h>     /* srand, rand */
+#include "CH_Algorithms.h"
+
+//Defined in test_header_only_unit.cpp
+std::vector<Point2f> hullFromOtherUnit(std::vector<Point2f> P);
+std::vector<Point2i> hullFromOtherUnit(std::vector<Point2i> P);
+SimdLevel simdLevelFromOtherUnit();
+void orientationBatchFromOtherUnit(const Point2f& A, const Point2f& B, const std::vector<Point2f> &C, signed char result[]);
+
+typedef bool (*ArrayOfTests[]) ();
+
+using namespace std;
+
+/**
+ * The hull computed in the other unit (parallel, exact) must be the same than the one computed here.
+ */
+bool test_same_hull ()
+{
+	const int N = 100000;
+	vector<Point2f> P;
+	for (int i = 0; i<N; i++)
+		P.push_back(Point2f((rand() % 1000000) / 100.0f, (rand() % 1000000) / 100.0f));
+	vector<Point2f> copy(P);
+	
+	vector<Point2f> expected_output = IterativeConvexHull (copy.data(), N);
+	vector<Point2f> vector_output = hullFromOtherUnit(P);
+	cout << "Hull here with " << expected_output.size() << " vertices, in the other unit with "
+		<< vector_output.size() << endl;
+	
+	return (expected_output == vector_output);
+}
+
+bool test_same_hull_integers ()
+{
+	const int N = 100000;
+	vector<Point2i> P;
+	for (int i = 0; i<N; i++)
+		P.push_back(Point2i(rand() % 2000001 - 1000000, rand() % 2000001 - 1000000));
+	vector<Point2i> copy(P);
+	
+	vector<Point2i> expected_output = DivideAndConquestConvexHull (copy.data(), N);
+	vector<Point2i> vector_output = hullFromOtherUnit(P);
+	cout << "Hull here with " << expected_output.size() << " vertices, in the other unit with "
+		<< vector_output.size() << endl;
+	
+	return (expected_output == vector_output);
+}
+
+/**
+ * The instruction set of orientationBatch is a single setting for the whole program
+ */
+bool test_shared_simd_level ()
+{
+	const int N = 1000;
+	vector<Point2f> C;
+	for (int i = 0; i<N; i++)
+		C.push_back(Point2f((rand() % 10000) / 100.0f, (rand() % 10000) / 100.0f));
+	Point2f A(0, 0), B(100, 100);
+	vector<signed char> here(N), there(N);
+	
+	SimdLevel previous = getSimdLevel();
+	bool passed = true;
+	for (int level = SIMD_SCALAR; level <= supportedSimdLevel() && passed; level++)
+	{
+		setSimdLevel((SimdLevel) level);
+		orientationBatch(A, B, C.data(), N, here.data());
+		orientationBatchFromOtherUnit(A, B, C, there.data());
+		cout << "Instruction set " << level << " here, " << simdLevelFromOtherUnit() << " in the other unit" << endl;
+		passed = simdLevelFromOtherUnit() == level && here == there;
+	}
+	setSimdLevel(previous);
+	return passed;
+}
+
+int main(int argc, char **argv)
+{
+	int failedTests = 0;
+	cout << "Testing the library headers in two translation units..." << endl << endl;
+	
+	ArrayOfTests tests = {test_same_hull,test_same_hull_integers,test_shared_simd_level};
+	const int NUM_TESTS = 3;
+	
+	for (int i = 0; i<NUM_TESTS; i++)
+	{
+		cout << "Starting test number " << i+1 << endl;
+		if (tests[i]())
+			cout << "The test " << i+1 << " was successfully passed!" << endl;
+		else
+		{
+			cout << "The test " << i+1 << " throw an incoherence" << endl;
+			failedTests++;
+		}
+		cout << "==================================================" << endl << endl;
+	}
+	
+	return failedTests > 0 ? 1 : 0;
+}
@@ -0,0 +1,42 @@
+/*
+ * test_header_only_unit.cpp
+ *
+ * Descp: 
+ *  Second translation unit of test_header_only.cpp: the same headers are included here, so the
+ *  executable only links if every function of the library is inline or a template.
+ *
+ ******************************************************************************
+ *  Created on: 17-10-2026
+ *      Author: Abel Serrano
+ */
+
+#include "CH_Algorithms.h"
+#include <vector>
+
+/**
+ * Parallel divide and conquer hull of P, with exact orientation tests
+ */
+std::vector<Point2f> hullFromOtherUnit(std::vector<Point2f> P)
+{
+	HullOptions options;
+	options.sortThreads = 2;
+	options.dcThreads = 4;
+	options.dcGrain = 1000;
+	options.exactOrientation = true;
+	return DivideAndConquestConvexHull(P.data(), P.size(), options);
+}
+
+std::vector<Point2i> hullFromOtherUnit(std::vector<Point2i> P)
+{
+	return IterativeConvexHull(P.data(), P.size());
+}
+
+SimdLevel simdLevelFromOtherUnit()
+{
+	return getSimdLevel();
+}
+
+void orientationBatchFromOtherUnit(const Point2f& A, const Point2f& B, const std::vector<Point2f> &C, signed char result[])
+{
+	orientationBatch(A, B, C.data(), C.size(), result);
+}